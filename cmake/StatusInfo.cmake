@@ -42,5 +42,17 @@ if(BUILD_TOOLS)
 else()
     message("Build tools           : No")
 endif()
+
+if(BUILD_LOADGEN)
+    message("Build load generator  : Yes")
+else()
+    message("Build load generator  : No (default)")
+endif()
+
+if(BUILD_BENCHMARKS)
+    message("Build benchmarks      : Yes")
+else()
+    message("Build benchmarks      : No (default)")
+endif()
 message("")
 message("===================================================")
@@ -31,6 +31,8 @@
 #include "SQLStorages.h"
 #include "World.h"
 
+#include <unordered_set>
+
  /** \addtogroup auctionbot
   * @{
   * \file
@@ -1347,10 +1349,11 @@ AuctionBotSeller::~AuctionBotSeller()
  */
 bool AuctionBotSeller::Initialize()
 {
-    std::vector<uint32> npcItems; // List of items sold by NPC vendors
-    std::vector<uint32> lootItems; // List of items obtained from loot
-    std::vector<uint32> includeItems; // List of items to be forcibly included
-    std::vector<uint32> excludeItems; // List of items to be forcibly excluded
+    // Hashed sets, every item template is checked against these below
+    std::unordered_set<uint32> npcItems; // Items sold by NPC vendors
+    std::unordered_set<uint32> lootItems; // Items obtained from loot
+    std::unordered_set<uint32> includeItems; // Items to be forcibly included
+    std::unordered_set<uint32> excludeItems; // Items to be forcibly excluded
 
     sLog.outString("AHBot seller filters:");
     sLog.outString();
@@ -1361,7 +1364,7 @@ bool AuctionBotSeller::Initialize()
         std::string temp;
         while (getline(includeStream, temp, ','))
         {
-            includeItems.push_back(atoi(temp.c_str()));
+            includeItems.insert(atoi(temp.c_str()));
         }
     }
 
@@ -1371,7 +1374,7 @@ bool AuctionBotSeller::Initialize()
         std::string temp;
         while (getline(excludeStream, temp, ','))
         {
-            excludeItems.push_back(atoi(temp.c_str()));
+            excludeItems.insert(atoi(temp.c_str()));
         }
     }
     sLog.outString("Forced Inclusion %zu items", includeItems.size());
@@ -1387,7 +1390,7 @@ bool AuctionBotSeller::Initialize()
         {
             bar.step();
             Field* fields = result->Fetch();
-            npcItems.push_back(fields[0].GetUInt32());
+            npcItems.insert(fields[0].GetUInt32());
         }
         while (result->NextRow());
         delete result;
@@ -1423,7 +1426,7 @@ bool AuctionBotSeller::Initialize()
                 continue;
             }
 
-            lootItems.push_back(fields[0].GetUInt32());
+            lootItems.insert(entry);
         }
         while (result->NextRow());
         delete result;
@@ -1460,26 +1463,13 @@ bool AuctionBotSeller::Initialize()
         }
 
         // Apply forced exclude filter
-        bool isExcludeItem = false;
-        for (size_t i = 0; (i < excludeItems.size() && (!isExcludeItem)); ++i)
-            if (itemID == excludeItems[i])
-            {
-                isExcludeItem = true;
-            }
-        if (isExcludeItem)
+        if (excludeItems.count(itemID))
         {
             continue;
         }
 
         // Apply forced include filter
-        bool isForcedIncludeItem = false;
-        for (size_t i = 0; (i < includeItems.size() && (!isForcedIncludeItem)); ++i)
-            if (itemID == includeItems[i])
-            {
-                isForcedIncludeItem = true;
-            }
-
-        if (isForcedIncludeItem)
+        if (includeItems.count(itemID))
         {
             m_ItemPool[prototype->Quality][prototype->Class].push_back(itemID);
             ++itemsAdded;
@@ -1542,14 +1532,7 @@ bool AuctionBotSeller::Initialize()
         // Apply vendor filter
         if (!sAuctionBotConfig.getConfig(CONFIG_BOOL_AHBOT_ITEMS_VENDOR))
         {
-            bool IsVendorItem = false;
-            for (size_t i = 0; (i < npcItems.size()) && (!IsVendorItem); ++i)
-                if (itemID == npcItems[i])
-                {
-                    IsVendorItem = true;
-                }
-
-            if (IsVendorItem)
+            if (npcItems.count(itemID))
             {
                 continue;
             }
@@ -1558,13 +1541,7 @@ bool AuctionBotSeller::Initialize()
         // Apply loot filter
         if (!sAuctionBotConfig.getConfig(CONFIG_BOOL_AHBOT_ITEMS_LOOT))
         {
-            bool isLootItem = false;
-            for (size_t i = 0; (i < lootItems.size()) && (!isLootItem); ++i)
-                if (itemID == lootItems[i])
-                {
-                    isLootItem = true;
-                }
-            if (isLootItem)
+            if (lootItems.count(itemID))
             {
                 continue;
             }
@@ -1573,22 +1550,7 @@ bool AuctionBotSeller::Initialize()
         // Apply miscellaneous filter
         if (!sAuctionBotConfig.getConfig(CONFIG_BOOL_AHBOT_ITEMS_MISC))
         {
-            bool IsVendorItem = false;
-            bool isLootItem = false;
-
-            for (size_t i = 0; (i < npcItems.size()) && (!IsVendorItem); ++i)
-                if (itemID == npcItems[i])
-                {
-                    IsVendorItem = true;
-                }
-
-            for (size_t i = 0; (i < lootItems.size()) && (!isLootItem); ++i)
-                if (itemID == lootItems[i])
-                {
-                    isLootItem = true;
-                }
-
-            if ((!isLootItem) && (!IsVendorItem))
+            if (!lootItems.count(itemID) && !npcItems.count(itemID))
             {
                 continue;
             }
@@ -2218,6 +2180,10 @@ void AuctionBotSeller::addNewAuctions(AHB_Seller_Config& config)
     RandomArray randArray;
     std::vector<std::vector<uint32>> ItemsAdded(MAX_AUCTION_QUALITY, std::vector<uint32>(MAX_ITEM_CLASS));
 
+    // Auctions created this cycle, written to the DB together once the loop is done
+    std::vector<AuctionEntry*> newAuctions;
+    newAuctions.reserve(items);
+
     // Main loop to add new auctions
     // getRandomArray will give the categories of items to be added (returns true if there is at least one missed item)
     while (getRandomArray(config, randArray, ItemsAdded) && (items > 0))
@@ -2250,7 +2216,7 @@ void AuctionBotSeller::addNewAuctions(AHB_Seller_Config& config)
         if (!item)
         {
             sLog.outError("AHBot: Item::CreateItem() returned NULL for item %u (stack: %u)", itemID, stackCount);
-            return;
+            break;
         }
 
         uint32 buyoutPrice;
@@ -2269,9 +2235,12 @@ void AuctionBotSeller::addNewAuctions(AHB_Seller_Config& config)
         // Set the prices of the item
         SetPricesOfItem(config, buyoutPrice, bidPrice, stackCount, ItemQualities(prototype->Quality));
 
-        // Add the auction to the auction house
-        auctionHouse->AddAuctionByGuid(ahEntry, item, urand(config.GetMinTime(), config.GetMaxTime()) * HOUR, bidPrice, buyoutPrice, sAuctionBotConfig.GetAHBotId());
+        // Add the auction to the auction house, persisted below with the rest of the batch
+        newAuctions.push_back(auctionHouse->AddAuctionByGuid(ahEntry, item, urand(config.GetMinTime(), config.GetMaxTime()) * HOUR, bidPrice, buyoutPrice, sAuctionBotConfig.GetAHBotId(), false));
     }
+
+    sAuctionMgr.SaveNewAuctionsToDB(newAuctions);
+    DEBUG_FILTER_LOG(LOG_FILTER_AHBOT_SELLER, "AHBot: %zu new auctions saved in one batch", newAuctions.size());
 }
 
 /**
@@ -31,6 +31,8 @@
 #include <ace/Recursive_Thread_Mutex.h>
 #include "Utilities/EventProcessor.h"
 
+#include <vector>
+
 /**
  * @brief Container for storing battleground instances.
  */
@@ -86,6 +88,9 @@ struct GroupQueueInfo
     uint32  JoinTime; /**< Time when group was added */
     uint32  RemoveInviteTime; /**< Time when we will remove invite for players in group */
     uint32  IsInvitedToBGInstanceGUID; /**< Was invited to certain BG */
+    BattleGroundBracketId BracketId; /**< Bracket of the queue the group is in */
+    uint8   QueueIndex; /**< BattleGroundQueueGroupTypes of the queue the group waits in */
+    std::list<GroupQueueInfo*>::iterator QueuePos; /**< Position in that queue, or in the invited groups of the bracket once invited */
 };
 
 /**
@@ -220,7 +225,8 @@ class BattleGroundQueue
 
         /**
          * @brief List for storing queued groups.
-         * We need constant add to begin and constant remove / add from the end, therefore deque suits our problem well.
+         * Groups keep their position (GroupQueueInfo::QueuePos) for constant time removal, and are spliced
+         * between lists without moving.
          */
         typedef std::list<GroupQueueInfo*> GroupsQueueType;
 
@@ -233,7 +239,23 @@ class BattleGroundQueue
              BG_QUEUE_NORMAL_ALLIANCE   is used for normal (or small) alliance groups or non-rated arena matches
              BG_QUEUE_NORMAL_HORDE      is used for normal (or small) horde groups or non-rated arena matches
          */
-        GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT]; /**< Two dimensional array for storing all queued groups. */
+        GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT]; /**< Two dimensional array for storing all groups waiting for an invite. */
+
+        /**
+         * @brief Groups invited to a battleground, per bracket.
+         * They leave m_QueuedGroups when invited, so the matching only walks groups that can still be selected,
+         * and stay here until their players enter the battleground or the invite expires.
+         */
+        GroupsQueueType m_InvitedGroups[MAX_BATTLEGROUND_BRACKETS];
+
+        uint32 m_QueuedPlayerCount[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT]; /**< Players of the groups in m_QueuedGroups. */
+
+        /**
+         * @brief Moves a waiting group to the front of another queue of its bracket.
+         * @param ginfo Pointer to the group queue info.
+         * @param index The BattleGroundQueueGroupTypes of the new queue.
+         */
+        void MoveGroupToQueueFront(GroupQueueInfo* ginfo, uint8 index);
 
         /**
          * @brief Class to select and invite groups to battleground.
@@ -273,7 +295,9 @@ class BattleGroundQueue
                 uint32 GetPlayerCount() const {return PlayerCount;}
 
             public:
-                GroupsQueueType SelectedGroups; /**< List of selected groups. */
+                typedef std::vector<GroupQueueInfo*> SelectedGroupsType;
+
+                SelectedGroupsType SelectedGroups; /**< Selected groups, the storage is kept between selections. */
 
             private:
                 uint32 PlayerCount; /**< Player count in the selection pool. */
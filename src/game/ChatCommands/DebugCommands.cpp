@@ -37,6 +37,7 @@
 #include "ObjectMgr.h"
 #include "ObjectGuid.h"
 #include "SpellMgr.h"
+#include "LootMgr.h"
 
 /**********************************************************************
      CommandTable : debugCommandTable
@@ -1351,6 +1352,98 @@ bool ChatHandler::HandleDebugModValueCommand(char* args)
     return HandlerDebugModValueHelper(target, field, typeStr, valStr);
 }
 
+/// Upper bound of .debug lootsim rolls, the simulation blocks the world thread while it runs
+#define MAX_LOOT_SIM_COUNT 100000
+
+// Rolls a loot template many times and reports the observed drop rates and the throughput
+bool ChatHandler::HandleDebugLootSimCommand(char* args)
+{
+    char* storeStr = ExtractLiteralArg(&args);
+    if (!storeStr)
+    {
+        return false;
+    }
+
+    LootStore const* store;
+    std::string storeName = storeStr;
+    if (storeName == "creature")
+    {
+        store = &LootTemplates_Creature;
+    }
+    else if (storeName == "gameobject")
+    {
+        store = &LootTemplates_Gameobject;
+    }
+    else if (storeName == "fishing")
+    {
+        store = &LootTemplates_Fishing;
+    }
+    else if (storeName == "item")
+    {
+        store = &LootTemplates_Item;
+    }
+    else if (storeName == "pickpocketing")
+    {
+        store = &LootTemplates_Pickpocketing;
+    }
+    else if (storeName == "skinning")
+    {
+        store = &LootTemplates_Skinning;
+    }
+    else if (storeName == "disenchant")
+    {
+        store = &LootTemplates_Disenchant;
+    }
+    else if (storeName == "mail")
+    {
+        store = &LootTemplates_Mail;
+    }
+    else if (storeName == "reference")
+    {
+        store = &LootTemplates_Reference;
+    }
+    else
+    {
+        return false;
+    }
+
+    uint32 lootId;
+    if (!ExtractUInt32(&args, lootId))
+    {
+        return false;
+    }
+
+    uint32 count;
+    if (!ExtractOptUInt32(&args, count, 10000) || !count)
+    {
+        return false;
+    }
+
+    if (count > MAX_LOOT_SIM_COUNT)
+    {
+        PSendSysMessage("Count limited to %u rolls.", MAX_LOOT_SIM_COUNT);
+        count = MAX_LOOT_SIM_COUNT;
+    }
+
+    std::map<uint32, uint32> drops;
+    uint32 timeMS = SimulateLoot(*store, lootId, count, drops);
+    if (!timeMS)
+    {
+        PSendSysMessage("Table '%s' has no loot id %u.", store->GetName(), lootId);
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    PSendSysMessage("Rolled %s loot %u %u times in %u ms (%.0f loots/s):", storeName.c_str(), lootId, count, timeMS, count * 1000.0f / timeMS);
+    for (std::map<uint32, uint32>::const_iterator itr = drops.begin(); itr != drops.end(); ++itr)
+    {
+        ItemPrototype const* proto = ObjectMgr::GetItemPrototype(itr->first);
+        PSendSysMessage("  item %u (%s): %u drops, %.4f%%", itr->first, proto ? proto->Name1 : "unknown", itr->second, itr->second * 100.0f / count);
+    }
+
+    return true;
+}
+
 bool ChatHandler::HandleDebugSpellCoefsCommand(char* args)
 {
     uint32 spellid = ExtractSpellIdFromLink(&args);
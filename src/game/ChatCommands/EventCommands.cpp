@@ -132,6 +132,28 @@ bool ChatHandler::HandleEventInfoCommand(char* args)
     return true;
 }
 
+/// Show the spawn steps of started and stopped events that are still queued
+bool ChatHandler::HandleEventProgressCommand(char* /*args*/)
+{
+    GameEventMgr::ProgressMap const& progress = sGameEventMgr.GetProgress();
+    if (progress.empty())
+    {
+        SendSysMessage("No game event spawns pending.");
+        return true;
+    }
+
+    GameEventMgr::GameEventDataMap const& events = sGameEventMgr.GetEventMap();
+
+    for (GameEventMgr::ProgressMap::const_iterator itr = progress.begin(); itr != progress.end(); ++itr)
+    {
+        PSendSysMessage("Event %u \"%s\" %s: %u/%u spawn steps done in %u ticks.", itr->first, events[itr->first].description.c_str(),
+                        itr->second.activate ? "starting" : "stopping", itr->second.done, itr->second.total, itr->second.ticks);
+    }
+
+    PSendSysMessage("%u spawn steps pending.", sGameEventMgr.GetPendingStepCount());
+    return true;
+}
+
 bool ChatHandler::HandleEventStartCommand(char* args)
 {
     if (!*args)
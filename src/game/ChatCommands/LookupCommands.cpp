@@ -29,6 +29,7 @@
 #include "World.h"
 #include "ObjectMgr.h"
 #include "SQLStorages.h"
+#include "NameLookupIndex.h"
 #include "Util.h"
 
  /**********************************************************************
@@ -702,27 +703,16 @@ bool ChatHandler::HandleLookupItemCommand(char* args)
 
     Player* pl = m_session ? m_session->GetPlayer() : NULL;
 
-    uint32 counter = 0;
-
-    // Search in `item_template`
-    for (uint32 id = 0; id < sItemStorage.GetMaxEntry(); ++id)
-    {
-        ItemPrototype const* pProto = sItemStorage.LookupEntry<ItemPrototype >(id);
-        if (!pProto)
-        {
-            continue;
-        }
-
-        int loc_idx = GetSessionDbLocaleIndex();
+    int loc_idx = GetSessionDbLocaleIndex();
 
-        std::string name;                                   // "" for let later only single time check default locale name directly
-        sObjectMgr.GetItemLocaleStrings(id, loc_idx, &name);
-        if ((name.empty() || !Utf8FitTo(name, wnamepart)) && !Utf8FitTo(pProto->Name1, wnamepart))
-        {
-            continue;
-        }
+    // Search in `item_template` names and the names of the session locale
+    std::vector<NameLookupMatch> matches;
+    sNameLookupMgr.Search(NAME_LOOKUP_ITEM, wnamepart, loc_idx, false, matches);
 
-        ShowItemListHelper(id, loc_idx, pl);
+    uint32 counter = 0;
+    for (std::vector<NameLookupMatch>::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
+    {
+        ShowItemListHelper(itr->id, loc_idx, pl);
         ++counter;
     }
 
@@ -932,47 +922,16 @@ bool ChatHandler::HandleLookupSpellCommand(char* args)
 
     uint32 counter = 0;                                     // Counter for figure out that we found smth.
 
-    // Search in Spell.dbc
-    for (uint32 id = 0; id < sSpellStore.GetNumRows(); ++id)
+    // Search in Spell.dbc, all locales, the session one preferred
+    std::vector<NameLookupMatch> matches;
+    sNameLookupMgr.Search(NAME_LOOKUP_SPELL, wnamepart, GetSessionDbcLocale(), true, matches);
+
+    for (std::vector<NameLookupMatch>::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        SpellEntry const* spellInfo = sSpellStore.LookupEntry(id);
-        if (spellInfo)
+        if (SpellEntry const* spellInfo = sSpellStore.LookupEntry(itr->id))
         {
-            int loc = GetSessionDbcLocale();
-            std::string name = spellInfo->SpellName[loc];
-            if (name.empty())
-            {
-                continue;
-            }
-
-            if (!Utf8FitTo(name, wnamepart))
-            {
-                loc = 0;
-                for (; loc < MAX_LOCALE; ++loc)
-                {
-                    if (loc == GetSessionDbcLocale())
-                    {
-                        continue;
-                    }
-
-                    name = spellInfo->SpellName[loc];
-                    if (name.empty())
-                    {
-                        continue;
-                    }
-
-                    if (Utf8FitTo(name, wnamepart))
-                    {
-                        break;
-                    }
-                }
-            }
-
-            if (loc < MAX_LOCALE)
-            {
-                ShowSpellListHelper(target, spellInfo, LocaleConstant(loc));
-                ++counter;
-            }
+            ShowSpellListHelper(target, spellInfo, LocaleConstant(itr->locIdx));
+            ++counter;
         }
     }
     if (counter == 0)                                       // if counter == 0 then we found nth
@@ -1007,20 +966,12 @@ bool ChatHandler::HandleLookupQuestCommand(char* args)
 
     int loc_idx = GetSessionDbLocaleIndex();
 
-    ObjectMgr::QuestMap const& qTemplates = sObjectMgr.GetQuestTemplates();
-    for (ObjectMgr::QuestMap::const_iterator iter = qTemplates.begin(); iter != qTemplates.end(); ++iter)
-    {
-        Quest* qinfo = iter->second;
-
-        std::string title;                                  // "" for avoid repeating check default locale
-        sObjectMgr.GetQuestLocaleStrings(qinfo->GetQuestId(), loc_idx, &title);
+    std::vector<NameLookupMatch> matches;
+    sNameLookupMgr.Search(NAME_LOOKUP_QUEST, wnamepart, loc_idx, false, matches);
 
-        if ((title.empty() || !Utf8FitTo(title, wnamepart)) && !Utf8FitTo(qinfo->GetTitle(), wnamepart))
-        {
-            continue;
-        }
-
-        ShowQuestListHelper(qinfo->GetQuestId(), loc_idx, target);
+    for (std::vector<NameLookupMatch>::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
+    {
+        ShowQuestListHelper(itr->id, loc_idx, target);
         ++counter;
     }
 
@@ -1052,34 +1003,33 @@ bool ChatHandler::HandleLookupCreatureCommand(char* args)
 
     uint32 counter = 0;
 
-    for (uint32 id = 0; id < sCreatureStorage.GetMaxEntry(); ++id)
+    int loc_idx = GetSessionDbLocaleIndex();
+
+    std::vector<NameLookupMatch> matches;
+    sNameLookupMgr.Search(NAME_LOOKUP_CREATURE, wnamepart, loc_idx, false, matches);
+
+    for (std::vector<NameLookupMatch>::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(id);
+        CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(itr->id);
         if (!cInfo)
         {
             continue;
         }
 
-        int loc_idx = GetSessionDbLocaleIndex();
-
-        char const* name = "";                              // "" for avoid repeating check for default locale
-        sObjectMgr.GetCreatureLocaleStrings(id, loc_idx, &name);
-        if (!*name || !Utf8FitTo(name, wnamepart))
+        // show the name that matched
+        char const* name = cInfo->Name;
+        if (itr->locIdx != NAME_LOOKUP_DEFAULT_LOCALE)
         {
-            name = cInfo->Name;
-            if (!Utf8FitTo(name, wnamepart))
-            {
-                continue;
-            }
+            sObjectMgr.GetCreatureLocaleStrings(itr->id, itr->locIdx, &name);
         }
 
         if (m_session)
         {
-            PSendSysMessage(LANG_CREATURE_ENTRY_LIST_CHAT, id, id, name);
+            PSendSysMessage(LANG_CREATURE_ENTRY_LIST_CHAT, itr->id, itr->id, name);
         }
         else
         {
-            PSendSysMessage(LANG_CREATURE_ENTRY_LIST_CONSOLE, id, name);
+            PSendSysMessage(LANG_CREATURE_ENTRY_LIST_CONSOLE, itr->id, name);
         }
 
         ++counter;
@@ -1113,53 +1063,39 @@ bool ChatHandler::HandleLookupObjectCommand(char* args)
 
     uint32 counter = 0;
 
-    for (SQLStorageBase::SQLSIterator<GameObjectInfo> itr = sGOStorage.getDataBegin<GameObjectInfo>(); itr < sGOStorage.getDataEnd<GameObjectInfo>(); ++itr)
+    int loc_idx = GetSessionDbLocaleIndex();
+
+    std::vector<NameLookupMatch> matches;
+    sNameLookupMgr.Search(NAME_LOOKUP_GAMEOBJECT, wnamepart, loc_idx, false, matches);
+
+    for (std::vector<NameLookupMatch>::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        int loc_idx = GetSessionDbLocaleIndex();
-        if (loc_idx >= 0)
+        GameObjectInfo const* goInfo = sGOStorage.LookupEntry<GameObjectInfo>(itr->id);
+        if (!goInfo)
+        {
+            continue;
+        }
+
+        // show the name that matched
+        std::string name = goInfo->name;
+        if (itr->locIdx != NAME_LOOKUP_DEFAULT_LOCALE)
         {
             GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(itr->id);
-            if (gl)
+            if (gl && (int32)gl->Name.size() > itr->locIdx)
             {
-                if ((int32)gl->Name.size() > loc_idx && !gl->Name[loc_idx].empty())
-                {
-                    std::string name = gl->Name[loc_idx];
-
-                    if (Utf8FitTo(name, wnamepart))
-                    {
-                        if (m_session)
-                        {
-                            PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->id, itr->id, name.c_str());
-                        }
-                        else
-                        {
-                            PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->id, name.c_str());
-                        }
-                        ++counter;
-                        continue;
-                    }
-                }
+                name = gl->Name[itr->locIdx];
             }
         }
 
-        std::string name = itr->name;
-        if (name.empty())
+        if (m_session)
         {
-            continue;
+            PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->id, itr->id, name.c_str());
         }
-
-        if (Utf8FitTo(name, wnamepart))
+        else
         {
-            if (m_session)
-            {
-                PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->id, itr->id, name.c_str());
-            }
-            else
-            {
-                PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->id, name.c_str());
-            }
-            ++counter;
+            PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->id, name.c_str());
         }
+        ++counter;
     }
 
     if (counter == 0)
@@ -240,6 +240,9 @@ bool ChatHandler::HandleMmapStatsCommand(char* /*args*/)
     MMAP::MMapManager* manager = MMAP::MMapFactory::createOrGetMMapManager();
     PSendSysMessage(" %u maps loaded with %u tiles overall", manager->getLoadedMapsCount(), manager->getLoadedTilesCount());
 
+    Map* map = m_session->GetPlayer()->GetMap();
+    PSendSysMessage(" %u full and %u incremental path builds on current map", map->GetFullPathBuildCount(), map->GetIncrementalPathBuildCount());
+
     const dtNavMesh* navmesh = manager->GetNavMesh(m_session->GetPlayer()->GetMapId());
     if (!navmesh)
     {
@@ -26,6 +26,7 @@
 #include "Language.h"
 #include "World.h"
 #include "PlayerDump.h"
+#include "Database/DatabaseEnv.h"
 
  /**********************************************************************
      CommandTable : commandTable
@@ -253,3 +254,45 @@ bool ChatHandler::HandlePDumpWriteCommand(char* args)
 
     return true;
 }
+
+bool ChatHandler::HandlePDumpWriteAllCommand(char* args)
+{
+    char* dir = ExtractQuotedOrLiteralArg(&args);
+    if (!dir)
+    {
+        return false;
+    }
+
+    uint32 threads;
+    if (!ExtractOptUInt32(&args, threads, 4) || !threads)
+    {
+        return false;
+    }
+
+    QueryResult* result = CharacterDatabase.Query("SELECT `guid` FROM `characters` WHERE `deleteDate` IS NULL");
+    if (!result)
+    {
+        SendSysMessage(LANG_PLAYER_NOT_FOUND);
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    PlayerDumpWriter::DumpFileList dumps;
+    do
+    {
+        uint32 lowguid = result->Fetch()[0].GetUInt32();
+        dumps.push_back(std::make_pair(lowguid, std::string(dir) + "/" + std::to_string(lowguid) + ".pdump"));
+    }
+    while (result->NextRow());
+    delete result;
+
+    if (!PlayerDumpWriter::StartDumps(dumps, threads))
+    {
+        SendSysMessage("Character dumps are already being written.");
+        SetSentErrorMessage(true);
+        return false;
+    }
+
+    PSendSysMessage("Writing %u character dumps to %s in the background, progress is in the server log.", uint32(dumps.size()), dir);
+    return true;
+}
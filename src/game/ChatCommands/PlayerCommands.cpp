@@ -27,6 +27,7 @@
 #include "World.h"
 #include "AccountMgr.h"
 #include "ObjectMgr.h"
+#include "CharacterDirectory.h"
 #include "SQLStorages.h"
 
 
@@ -153,6 +154,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
         PSendSysMessage(LANG_RENAME_PLAYER, GetNameLink(target).c_str());
         target->SetAtLoginFlag(AT_LOGIN_RENAME);
         CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '1' WHERE `guid` = '%u'", target->GetGUIDLow());
+        sCharacterDirectory.SetAtLoginFlags(target->GetGUIDLow(), uint32(AT_LOGIN_RENAME), 0);
     }
     else
     {
@@ -166,6 +168,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
 
         PSendSysMessage(LANG_RENAME_PLAYER_GUID, oldNameLink.c_str(), target_guid.GetCounter());
         CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '1' WHERE `guid` = '%u'", target_guid.GetCounter());
+        sCharacterDirectory.SetAtLoginFlags(target_guid.GetCounter(), uint32(AT_LOGIN_RENAME), 0);
     }
 
     return true;
@@ -361,6 +364,8 @@ void ChatHandler::HandleCharacterDeletedRestoreHelper(DeletedInfo const& delInfo
 
     CharacterDatabase.PExecute("UPDATE `characters` SET `name`='%s', `account`='%u', `deleteDate`=NULL, `deleteInfos_Name`=NULL, `deleteInfos_Account`=NULL WHERE `deleteDate` IS NOT NULL AND `guid` = %u",
                                delInfo.name.c_str(), delInfo.accountId, delInfo.lowguid);
+
+    sCharacterDirectory.ReloadCharacter(delInfo.lowguid);
 }
 
 /**
@@ -569,6 +574,7 @@ void ChatHandler::HandleCharacterLevel(Player* player, ObjectGuid player_guid, u
     {
         // update level and XP at level, all other will be updated at loading
         CharacterDatabase.PExecute("UPDATE `characters` SET `level` = '%u', `xp` = 0 WHERE `guid` = '%u'", newlevel, player_guid.GetCounter());
+        sCharacterDirectory.SetLevel(player_guid.GetCounter(), newlevel);
     }
 }
 
@@ -26,6 +26,7 @@
 #include "Language.h"
 #include "World.h"
 #include "Mail.h"
+#include "CharacterDirectory.h"
 
  /**********************************************************************
      CommandTable : commandTable
@@ -174,6 +175,7 @@ bool ChatHandler::HandleResetSpellsCommand(char* args)
     else
     {
         CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '%u' WHERE `guid` = '%u'", uint32(AT_LOGIN_RESET_SPELLS), target_guid.GetCounter());
+        sCharacterDirectory.SetAtLoginFlags(target_guid.GetCounter(), uint32(AT_LOGIN_RESET_SPELLS), 0);
         PSendSysMessage(LANG_RESET_SPELLS_OFFLINE, target_name.c_str());
     }
 
@@ -205,6 +207,7 @@ bool ChatHandler::HandleResetTalentsCommand(char* args)
     {
         uint32 at_flags = AT_LOGIN_RESET_TALENTS;
         CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '%u' WHERE `guid` = '%u'", at_flags, target_guid.GetCounter());
+        sCharacterDirectory.SetAtLoginFlags(target_guid.GetCounter(), at_flags, 0);
         std::string nameLink = playerLink(target_name);
         PSendSysMessage(LANG_RESET_TALENTS_OFFLINE, nameLink.c_str());
         return true;
@@ -253,6 +256,7 @@ bool ChatHandler::HandleResetAllCommand(char* args)
     }
 
     CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '%u' WHERE (`at_login` & '%u') = '0'", atLogin, atLogin);
+    sCharacterDirectory.AddAtLoginFlagsToAll(uint32(atLogin));
     sObjectAccessor.DoForAllPlayers([&atLogin](Player* plr) { plr->SetAtLoginFlag(atLogin); });
     return true;
 }
@@ -32,6 +32,7 @@
 #include "BattleGroundMgr.h"
 #include "ItemEnchantmentMgr.h"
 #include "CommandMgr.h"
+#include "NameLookupIndex.h"
 
  /**********************************************************************
      CommandTable : commandTable
@@ -307,6 +308,7 @@ bool ChatHandler::HandleReloadQuestTemplateCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Quest Templates...");
     sObjectMgr.LoadQuests();
+    sNameLookupMgr.Load(NAME_LOOKUP_QUEST);
     SendGlobalSysMessage("DB table `quest_template` (quest definitions) reloaded.", SEC_MODERATOR);
 
     /// dependent also from `gameobject` but this table not reloaded anyway
@@ -874,6 +876,7 @@ bool ChatHandler::HandleReloadLocalesCreatureCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Creature ...");
     sObjectMgr.LoadCreatureLocales();
+    sNameLookupMgr.Load(NAME_LOOKUP_CREATURE);
     SendGlobalSysMessage("DB table `locales_creature` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -882,6 +885,7 @@ bool ChatHandler::HandleReloadLocalesGameobjectCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Gameobject ... ");
     sObjectMgr.LoadGameObjectLocales();
+    sNameLookupMgr.Load(NAME_LOOKUP_GAMEOBJECT);
     SendGlobalSysMessage("DB table `locales_gameobject` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -898,6 +902,7 @@ bool ChatHandler::HandleReloadLocalesItemCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Item ... ");
     sObjectMgr.LoadItemLocales();
+    sNameLookupMgr.Load(NAME_LOOKUP_ITEM);
     SendGlobalSysMessage("DB table `locales_item` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -938,6 +943,7 @@ bool ChatHandler::HandleReloadLocalesQuestCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Quest ... ");
     sObjectMgr.LoadQuestLocales();
+    sNameLookupMgr.Load(NAME_LOOKUP_QUEST);
     SendGlobalSysMessage("DB table `locales_quest` reloaded.", SEC_MODERATOR);
     return true;
 }
@@ -947,6 +953,7 @@ bool ChatHandler::HandleReloadDisablesCommand(char* /*args*/)
     sLog.outString("Re-loading Disables...");
     DisableMgr::LoadDisables();
     DisableMgr::CheckQuestDisables();
+    CompileLootTables();                                    // disabled item drops are left out of the loot roll tables
     SendGlobalSysMessage("DB table `disables` reloaded.", SEC_MODERATOR);
     return true;
 }
\ No newline at end of file
@@ -29,6 +29,7 @@
 #include "GitRevision.h"
 #include "SystemConfig.h"
 #include "UpdateTime.h"
+#include "TickProfiler.h"
 #include "revision_data.h"
 
  /**********************************************************************
@@ -84,6 +85,57 @@ bool ChatHandler::HandleServerMotdCommand(char* /*args*/)
     return true;
 }
 
+/// Show tick profiler results, or control the profiler with on/off/reset/json
+bool ChatHandler::HandleServerPerfCommand(char* args)
+{
+    if (*args)
+    {
+        char* param = ExtractLiteralArg(&args);
+        if (!param)
+        {
+            return false;
+        }
+
+        int l = strlen(param);
+
+        if (strncmp(param, "on", l) == 0)
+        {
+            sTickProfiler.SetEnabled(true);
+            SendSysMessage("Tick profiler enabled.");
+            return true;
+        }
+        else if (strncmp(param, "off", l) == 0)
+        {
+            sTickProfiler.SetEnabled(false);
+            SendSysMessage("Tick profiler disabled.");
+            return true;
+        }
+        else if (strncmp(param, "reset", l) == 0)
+        {
+            sTickProfiler.Reset();
+            SendSysMessage("Tick profiler counters reset.");
+            return true;
+        }
+        else if (strncmp(param, "json", l) == 0)
+        {
+            // one chat line per member and array element, a single line would exceed the chat limit
+            SendSysMessage(sTickProfiler.BuildJson(true).c_str());
+            return true;
+        }
+
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    sTickProfiler.BuildReport(lines, 10);
+    for (std::vector<std::string>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr)
+    {
+        SendSysMessage(itr->c_str());
+    }
+
+    return true;
+}
+
 bool ChatHandler::HandleServerShutDownCancelCommand(char* /*args*/)
 {
     sWorld.ShutdownCancel();
@@ -45,6 +45,8 @@ PathFinder::PathFinder(const Unit* owner) :
     DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::PathFinder for %s \n", m_sourceUnit->GetGuidStr().c_str());
 
     memset(m_pathPolyRefs, 0, sizeof(m_pathPolyRefs));
+    memset(m_corridorStart, 0, sizeof(m_corridorStart));
+    memset(m_corridorEnd, 0, sizeof(m_corridorEnd));
 
     uint32 mapId = m_sourceUnit->GetMapId();
 
@@ -79,12 +81,25 @@ bool PathFinder::calculate(float destX, float destY, float destZ, bool forceDest
     float x, y, z;
     m_sourceUnit->GetPosition(x, y, z);
 
-    if (!MaNGOS::IsValidMapCoord(x,y,z) || !MaNGOS::IsValidMapCoord(destX, destY, destZ))
+    return calculate(Vector3(x, y, z), destX, destY, destZ, forceDest);
+}
+
+/**
+ * @brief Calculates the path from a given start to the destination.
+ * @param start The start of the path.
+ * @param destX The X-coordinate of the destination.
+ * @param destY The Y-coordinate of the destination.
+ * @param destZ The Z-coordinate of the destination.
+ * @param forceDest Whether to force the destination.
+ * @return False if the start or the destination is not a valid map coordinate, true otherwise.
+ */
+bool PathFinder::calculate(Vector3 const& start, float destX, float destY, float destZ, bool forceDest)
+{
+    if (!MaNGOS::IsValidMapCoord(start.x, start.y, start.z) || !MaNGOS::IsValidMapCoord(destX, destY, destZ))
     {
         return false;
     }
 
-    Vector3 start(x, y, z);
     setStartPosition(start);
 
     Vector3 dest(destX, destY, destZ);
@@ -312,16 +327,27 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
         m_pathPolyRefs[0] = startPoly;
         m_polyLength = 1;
 
+        dtVcopy(m_corridorStart, startPoint);
+        dtVcopy(m_corridorEnd, endPoint);
+
         m_type = farFromPoly ? PATHFIND_INCOMPLETE : PATHFIND_NORMAL;
         DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ BuildPolyPath :: path type %d for %s\n", m_type, m_sourceUnit->GetGuidStr().c_str());
         return;
     }
 
+    // tiles can be unloaded or rebuilt under our feet, never reuse a stale corridor
+    if (m_polyLength && !isCorridorValid())
+    {
+        DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ BuildPolyPath :: corridor invalidated for %s\n", m_sourceUnit->GetGuidStr().c_str());
+        clear();
+    }
+
     // look for startPoly/endPoly in current path
     // TODO: we can merge it with getPathPolyByPosition() loop
     bool startPolyFound = false;
     bool endPolyFound = false;
-    uint32 pathStartIndex, pathEndIndex;
+    uint32 pathStartIndex = 0;
+    uint32 pathEndIndex = 0;
 
     if (m_polyLength)
     {
@@ -337,6 +363,13 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
             }
         }
 
+        // we were pushed off our corridor (knockback, charge, ...) - try to walk its start back to us
+        if (!startPolyFound && moveCorridorStart(startPoly, startPoint))
+        {
+            startPolyFound = true;
+            pathStartIndex = 0;
+        }
+
         for (pathEndIndex = m_polyLength - 1; pathEndIndex > pathStartIndex; --pathEndIndex)
         {
             if (m_pathPolyRefs[pathEndIndex] == endPoly)
@@ -357,6 +390,15 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
 
         m_polyLength = pathEndIndex - pathStartIndex + 1;
         memmove(m_pathPolyRefs, m_pathPolyRefs + pathStartIndex, m_polyLength * sizeof(dtPolyRef));
+
+        m_sourceUnit->GetMap()->AddPathBuild(true);
+    }
+    else if (startPolyFound && moveCorridorEnd(pathStartIndex, endPoly, endPoint))
+    {
+        DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ BuildPolyPath :: (startPolyFound && corridor end moved) for %s\n", m_sourceUnit->GetGuidStr().c_str());
+
+        // target only moved a few yards, the corridor end was slid along the mesh surface
+        m_sourceUnit->GetMap()->AddPathBuild(true);
     }
     else if (startPolyFound && !endPolyFound)
     {
@@ -423,6 +465,8 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
 
         // new path = prefix + suffix - overlap
         m_polyLength = prefixPolyLength + suffixPolyLength - 1;
+
+        m_sourceUnit->GetMap()->AddPathBuild(true);
     }
      else
     {
@@ -454,6 +498,8 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
             m_type = PATHFIND_NOPATH;
             return;
         }
+
+        m_sourceUnit->GetMap()->AddPathBuild(false);
     }
 
     // by now we know what type of path we can get
@@ -466,10 +512,92 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
         m_type = PATHFIND_INCOMPLETE;
     }
 
+    // remember where the corridor was built for, so the next call can move its ends incrementally
+    dtVcopy(m_corridorStart, startPoint);
+    dtVcopy(m_corridorEnd, endPoint);
+
     // generate the point-path out of our up-to-date poly-path
     BuildPointPath(startPoint, endPoint);
 }
 
+/**
+ * @brief Checks that every polygon of the current corridor still exists in the navmesh.
+ * @return True if the corridor can be reused, false otherwise.
+ */
+bool PathFinder::isCorridorValid() const
+{
+    for (uint32 i = 0; i < m_polyLength; ++i)
+    {
+        if (!m_navMeshQuery->isValidPolyRef(m_pathPolyRefs[i], &m_filter))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Moves the start of the corridor to the given point along the navmesh surface.
+ * @param startPoly The polygon containing the new start point.
+ * @param startPoint The new start point.
+ * @return True if the corridor now starts at startPoly, false if it has to be rebuilt.
+ */
+bool PathFinder::moveCorridorStart(dtPolyRef startPoly, const float* startPoint)
+{
+    if (!m_polyLength || dtVdist2DSqr(m_corridorStart, startPoint) > CORRIDOR_MAX_SHIFT * CORRIDOR_MAX_SHIFT)
+    {
+        return false;
+    }
+
+    float resultPos[VERTEX_SIZE];
+    dtPolyRef visited[MAX_CORRIDOR_VISITED];
+    int nvisited = 0;
+    dtStatus dtResult = m_navMeshQuery->moveAlongSurface(m_pathPolyRefs[0], m_corridorStart, startPoint, &m_filter,
+                        resultPos, visited, &nvisited, MAX_CORRIDOR_VISITED);
+    if (dtStatusFailed(dtResult) || !nvisited || visited[nvisited - 1] != startPoly ||
+        !inRangeYZX(resultPos, startPoint, SMOOTH_PATH_SLOP, SMOOTH_PATH_HEIGHT))
+    {
+        return false;
+    }
+
+    m_polyLength = fixupCorridor(m_pathPolyRefs, m_polyLength, MAX_PATH_LENGTH, visited, uint32(nvisited));
+    return m_pathPolyRefs[0] == startPoly;
+}
+
+/**
+ * @brief Trims the corridor to startIndex and moves its end to the given point along the navmesh surface.
+ * @param startIndex Index of our current polygon in the corridor.
+ * @param endPoly The polygon containing the new end point.
+ * @param endPoint The new end point.
+ * @return True if the corridor now leads to endPoly, false if the corridor was left untouched.
+ */
+bool PathFinder::moveCorridorEnd(uint32 startIndex, dtPolyRef endPoly, const float* endPoint)
+{
+    // an incomplete corridor does not end on the polygon of its end point, nothing to slide
+    if (startIndex >= m_polyLength || !(m_type & PATHFIND_NORMAL) ||
+        dtVdist2DSqr(m_corridorEnd, endPoint) > CORRIDOR_MAX_SHIFT * CORRIDOR_MAX_SHIFT)
+    {
+        return false;
+    }
+
+    float resultPos[VERTEX_SIZE];
+    dtPolyRef visited[MAX_CORRIDOR_VISITED];
+    int nvisited = 0;
+    dtStatus dtResult = m_navMeshQuery->moveAlongSurface(m_pathPolyRefs[m_polyLength - 1], m_corridorEnd, endPoint, &m_filter,
+                        resultPos, visited, &nvisited, MAX_CORRIDOR_VISITED);
+    if (dtStatusFailed(dtResult) || !nvisited || visited[nvisited - 1] != endPoly ||
+        !inRangeYZX(resultPos, endPoint, SMOOTH_PATH_SLOP, SMOOTH_PATH_HEIGHT))
+    {
+        return false;
+    }
+
+    uint32 polyLength = m_polyLength - startIndex;
+    memmove(m_pathPolyRefs, m_pathPolyRefs + startIndex, polyLength * sizeof(dtPolyRef));
+    m_polyLength = mergeCorridorEndMoved(m_pathPolyRefs, polyLength, MAX_PATH_LENGTH, visited, uint32(nvisited));
+    return true;
+}
+
 /**
  * @brief Builds the point path from the start point to the end point.
  * @param startPoint The start point.
@@ -726,6 +854,58 @@ uint32 PathFinder::fixupCorridor(dtPolyRef* path, uint32 npath, uint32 maxPath,
     return req + size;
 }
 
+/**
+ * @brief Replaces the tail of the path with the polygons visited while moving its end.
+ * @param path The current path.
+ * @param npath The number of polygons in the current path.
+ * @param maxPath The maximum number of polygons in the path.
+ * @param visited The visited path, starting at the old end polygon.
+ * @param nvisited The number of polygons in the visited path.
+ * @return The number of polygons in the merged path.
+ */
+uint32 PathFinder::mergeCorridorEndMoved(dtPolyRef* path, uint32 npath, uint32 maxPath,
+                                         const dtPolyRef* visited, uint32 nvisited)
+{
+    int32 furthestPath = -1;
+    int32 furthestVisited = -1;
+
+    // Find first path polygon that was also visited (the target may have walked back along the corridor).
+    for (int32 i = 0; i < int32(npath); ++i)
+    {
+        bool found = false;
+        for (int32 j = nvisited - 1; j >= 0; --j)
+        {
+            if (path[i] == visited[j])
+            {
+                furthestPath = i;
+                furthestVisited = j;
+                found = true;
+            }
+        }
+        if (found)
+        {
+            break;
+        }
+    }
+
+    // If no intersection found just return current path.
+    if (furthestPath == -1 || furthestVisited == -1)
+    {
+        return npath;
+    }
+
+    // Concatenate paths.
+    uint32 ppos = furthestPath + 1;
+    uint32 vpos = furthestVisited + 1;
+    uint32 count = std::min(nvisited - vpos, maxPath - ppos);
+    if (count)
+    {
+        memcpy(path + ppos, visited + vpos, count * sizeof(dtPolyRef));
+    }
+
+    return ppos + count;
+}
+
 /**
  * @brief Gets the steer target for the path.
  * @param startPos The start position.
@@ -46,6 +46,10 @@ class Unit;
 #define SMOOTH_PATH_SLOP        0.3f
 #define SMOOTH_PATH_HEIGHT      1.0f
 
+// how far the ends of an existing corridor may be moved along the mesh before we repath from scratch
+#define CORRIDOR_MAX_SHIFT      10.0f
+#define MAX_CORRIDOR_VISITED    16
+
 #define VERTEX_SIZE       3
 #define INVALID_POLYREF   0
 
@@ -85,10 +89,22 @@ class PathFinder
          * @param destY Y-coordinate of the destination.
          * @param destZ Z-coordinate of the destination.
          * @param forceDest Whether to force the destination.
-         * @return True if a new path was calculated, false otherwise (no change needed).
+         * @return False if the start or the destination is not a valid map coordinate, true otherwise (the path may be a shortcut, see getPathType()).
          */
         bool calculate(float destX, float destY, float destZ, bool forceDest = false);
 
+        /**
+         * @brief Calculate the path from a given start to given destination.
+         * Used to chain the paths between points the owner hasn't reached yet.
+         * @param start Start of the path.
+         * @param destX X-coordinate of the destination.
+         * @param destY Y-coordinate of the destination.
+         * @param destZ Z-coordinate of the destination.
+         * @param forceDest Whether to force the destination.
+         * @return False if the start or the destination is not a valid map coordinate, true otherwise (the path may be a shortcut, see getPathType()).
+         */
+        bool calculate(Vector3 const& start, float destX, float destY, float destZ, bool forceDest = false);
+
         // Option setters - use optional
         /**
          * @brief Set whether to use a straight path.
@@ -143,6 +159,8 @@ class PathFinder
 
         dtPolyRef      m_pathPolyRefs[MAX_PATH_LENGTH];   // Array of detour polygon references
         uint32         m_polyLength;                      // Number of polygons in the path
+        float          m_corridorStart[VERTEX_SIZE];      // Detour position the corridor was built from
+        float          m_corridorEnd[VERTEX_SIZE];        // Detour position the corridor was built to
 
         PointsArray    m_pathPoints;       // Our actual (x,y,z) path to the target
         PathType       m_type;             // Tells what kind of path this is
@@ -279,6 +297,41 @@ class PathFinder
          */
         void updateFilter();
 
+        /**
+         * @brief Check that all polygons of the current corridor are still valid.
+         * @return True if the corridor can be reused, false otherwise.
+         */
+        bool isCorridorValid() const;
+
+        /**
+         * @brief Move the start of the corridor to the given point along the navmesh surface.
+         * @param startPoly The polygon containing the new start point.
+         * @param startPoint The new start point.
+         * @return True if the corridor now starts at startPoly, false otherwise.
+         */
+        bool moveCorridorStart(dtPolyRef startPoly, const float* startPoint);
+
+        /**
+         * @brief Trim the corridor and move its end to the given point along the navmesh surface.
+         * @param startIndex Index of the current start polygon in the corridor.
+         * @param endPoly The polygon containing the new end point.
+         * @param endPoint The new end point.
+         * @return True if the corridor now leads to endPoly, false if it was left untouched.
+         */
+        bool moveCorridorEnd(uint32 startIndex, dtPolyRef endPoly, const float* endPoint);
+
+        /**
+         * @brief Merge the polygons visited while moving the corridor end into the path.
+         * @param path The path.
+         * @param npath The number of path polygons.
+         * @param maxPath The maximum path length.
+         * @param visited The visited polygons.
+         * @param nvisited The number of visited polygons.
+         * @return The merged path length.
+         */
+        uint32 mergeCorridorEndMoved(dtPolyRef* path, uint32 npath, uint32 maxPath,
+                                     const dtPolyRef* visited, uint32 nvisited);
+
         // Smooth path auxiliary functions
         /**
          * @brief Fix up the corridor path.
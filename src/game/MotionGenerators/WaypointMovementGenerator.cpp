@@ -82,6 +82,7 @@ void WaypointMovementGenerator<Creature>::LoadPath(Creature& creature, int32 pat
     // Initialize the i_currentNode to point to the first node
     i_currentNode = i_path->begin()->first;
     m_lastReachedWaypoint = 0;
+    m_splineNodeCount = 0;
 }
 
 /**
@@ -303,16 +304,169 @@ void WaypointMovementGenerator<Creature>::StartMove(Creature& creature)
 
     creature.addUnitState(UNIT_STAT_ROAMING_MOVE);
 
-    WaypointNode const& nextNode = currPoint->second;;
+    Movement::PointsArray splinePath;
+    uint8 nodeCount = BuildSplinePath(creature, splinePath);
+
+    // the final facing is the one of the last node the spline runs to
+    WaypointNode const* lastNode = &currPoint->second;
+    if (nodeCount > 1)
+    {
+        WaypointPathPoints const& points = i_path->GetPoints();
+        uint32 lastIdx = (i_path->GetPointIndex(i_currentNode) + nodeCount - 1) % points.size();
+        lastNode = &i_path->find(points[lastIdx].pointId)->second;
+    }
+
     Movement::MoveSplineInit init(creature);
-    init.MoveTo(nextNode.x, nextNode.y, nextNode.z, true);
+    init.MovebyPath(splinePath);
 
-    if (nextNode.orientation != 100 && nextNode.delay != 0)
+    if (lastNode->orientation != 100 && lastNode->delay != 0)
     {
-        init.SetFacing(nextNode.orientation);
+        init.SetFacing(lastNode->orientation);
     }
     creature.SetWalk(!creature.hasUnitState(UNIT_STAT_RUNNING_STATE) && !creature.IsLevitating(), false);
-    init.Launch();
+    m_splineNodeCount = init.Launch() ? nodeCount : 0;
+    m_splineNodesPassed = 0;
+    m_splineId = creature.movespline->GetId();
+}
+
+/**
+ * @brief Gets the length of a path.
+ * @param path The path points.
+ * @return The sum of the distances between the points.
+ */
+static float GetPathLength(Movement::PointsArray const& path)
+{
+    float length = 0.0f;
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        length += (path[i] - path[i - 1]).length();
+    }
+
+    return length;
+}
+
+/**
+ * @brief Builds the spline path from the creature to i_currentNode, and on through the nodes after it
+ * while they need no stop, up to WAYPOINT_SPLINE_MAX_NODES nodes and WAYPOINT_SPLINE_MAX_LENGTH yards.
+ * @param creature Reference to the creature.
+ * @param splinePath Receives the path, its first point is replaced by the launch.
+ * @return The number of path nodes the spline runs to, their spline vertices are in m_splineNodeEnds.
+ */
+uint8 WaypointMovementGenerator<Creature>::BuildSplinePath(Creature& creature, Movement::PointsArray& splinePath)
+{
+    WaypointPathPoints const& points = i_path->GetPoints();
+    uint32 firstIdx = i_path->GetPointIndex(i_currentNode);
+    MANGOS_ASSERT(firstIdx < points.size());
+
+    PathFinder pathFinder(&creature);
+    float splineLength = 0.0f;
+    uint8 nodeCount = 0;
+    for (uint32 pointIdx = firstIdx;;)
+    {
+        WaypointPathPoint const& point = points[pointIdx];
+
+        bool found;
+        if (!nodeCount)
+        {
+            found = pathFinder.calculate(point.x, point.y, point.z) && !(pathFinder.getPathType() & PATHFIND_NOPATH) && pathFinder.getPath().size() > 1;
+            if (found)
+            {
+                splinePath = pathFinder.getPath();
+            }
+            else
+            {
+                splinePath.resize(2);
+                splinePath[1] = Vector3(point.x, point.y, point.z);
+            }
+        }
+        else
+        {
+            // continue from where the path to the previous node ended
+            found = pathFinder.calculate(splinePath.back(), point.x, point.y, point.z) && !(pathFinder.getPathType() & PATHFIND_NOPATH) && pathFinder.getPath().size() > 1;
+            if (!found)
+            {
+                break;
+            }
+
+            Movement::PointsArray const& segment = pathFinder.getPath();
+            float segmentLength = GetPathLength(segment);
+            if (splineLength + segmentLength > WAYPOINT_SPLINE_MAX_LENGTH)
+            {
+                break;
+            }
+
+            splinePath.insert(splinePath.end(), segment.begin() + 1, segment.end());
+        }
+
+        splineLength = GetPathLength(splinePath);
+        m_splineNodeEnds[nodeCount++] = splinePath.size() - 1;
+
+        // external paths inform their script as each node is left
+        if (!found || (pathFinder.getPathType() & PATHFIND_INCOMPLETE) || !point.passThrough ||
+            nodeCount == WAYPOINT_SPLINE_MAX_NODES || m_PathOrigin == PATH_FROM_EXTERNAL)
+        {
+            break;
+        }
+
+        pointIdx = (pointIdx + 1) % points.size();
+        // don't run the whole path, nor pathfind a segment that can't fit
+        if (pointIdx == firstIdx || splineLength + points[pointIdx].length > WAYPOINT_SPLINE_MAX_LENGTH)
+        {
+            break;
+        }
+    }
+
+    return nodeCount;
+}
+
+/**
+ * @brief Arrives at the nodes the running spline went past, the last one is left to Update.
+ * @param creature Reference to the creature.
+ * @return False if an arrival stopped the creature or moved it elsewhere.
+ */
+bool WaypointMovementGenerator<Creature>::PassSplineNodes(Creature& creature)
+{
+    if (creature.movespline->GetId() != m_splineId)
+    {
+        m_splineNodeCount = 0;
+        return true;
+    }
+
+    int32 splineIdx = creature.movespline->currentPathIdx();
+    while (m_splineNodesPassed + 1 < m_splineNodeCount && m_splineNodeEnds[m_splineNodesPassed] <= splineIdx)
+    {
+        ++m_splineNodesPassed;
+        OnArrived(creature);
+
+        // the AI started other movement at the node
+        if (creature.movespline->GetId() != m_splineId)
+        {
+            m_splineNodeCount = 0;
+            return false;
+        }
+
+        // or paused the creature there or sent it to another node
+        if (!m_splineNodeCount || Stopped(creature))
+        {
+            m_splineNodeCount = 0;
+            creature.InterruptMoving();
+            return false;
+        }
+
+        WaypointPathPoints const& points = i_path->GetPoints();
+        uint32 pointIdx = i_path->GetPointIndex(i_currentNode);
+        if (pointIdx >= points.size())
+        {
+            m_splineNodeCount = 0;
+            return true;
+        }
+
+        i_currentNode = points[(pointIdx + 1) % points.size()].pointId;
+        m_isArrivalDone = false;
+        creature.addUnitState(UNIT_STAT_ROAMING_MOVE);
+    }
+
+    return true;
 }
 
 /**
@@ -353,8 +507,15 @@ bool WaypointMovementGenerator<Creature>::Update(Creature& creature, const uint3
         }
         else if (creature.movespline->Finalized())
         {
-            OnArrived(creature);
-            StartMove(creature);
+            if (PassSplineNodes(creature))
+            {
+                OnArrived(creature);
+                StartMove(creature);
+            }
+        }
+        else
+        {
+            PassSplineNodes(creature);
         }
     }
     return true;
@@ -492,6 +653,7 @@ bool WaypointMovementGenerator<Creature>::SetNextWaypoint(uint32 pointId)
     // If this function is called while PAUSED, it will move properly when unpaused.
     i_nextMoveTime.Reset(1);
     m_isArrivalDone = false;
+    m_splineNodeCount = 0;
 
     // Set the point
     i_currentNode = pointId;
@@ -34,12 +34,16 @@
 #include "MovementGenerator.h"
 #include "WaypointManager.h"
 #include "DBCStructure.h"
+#include "movement/MoveSplineInitArgs.h"
 
 #include <set>
 
 #define FLIGHT_TRAVEL_UPDATE  100
 #define STOP_TIME_FOR_PLAYER  (3 * MINUTE * IN_MILLISECONDS)// 3 Minutes
 
+#define WAYPOINT_SPLINE_MAX_NODES   8                       // path nodes one waypoint spline runs to at most
+#define WAYPOINT_SPLINE_MAX_LENGTH  120.0f                  // keeps the spline vertices in range of the packed monster move offsets
+
 /**
  * @brief Base class for path movement generators.
  * @tparam T Type of the unit (Player or Creature).
@@ -75,7 +79,7 @@ class WaypointMovementGenerator<Creature>
       public PathMovementBase<Creature, WaypointPath const*>
 {
     public:
-        WaypointMovementGenerator(Creature&) : i_nextMoveTime(0), m_isArrivalDone(false), m_lastReachedWaypoint(0), m_pathId(0) {}
+        WaypointMovementGenerator(Creature&) : i_nextMoveTime(0), m_isArrivalDone(false), m_lastReachedWaypoint(0), m_splineId(0), m_splineNodeCount(0), m_splineNodesPassed(0), m_pathId(0) {}
         ~WaypointMovementGenerator() { i_path = NULL; }
 
         void Initialize(Creature& u);
@@ -105,10 +109,27 @@ class WaypointMovementGenerator<Creature>
         void OnArrived(Creature&);
         void StartMove(Creature&);
 
+        /**
+         * @brief Builds the spline path from the creature to i_currentNode and on through the following pass-through nodes.
+         * @return The number of path nodes the spline runs to.
+         */
+        uint8 BuildSplinePath(Creature& creature, Movement::PointsArray& splinePath);
+
+        /**
+         * @brief Arrives at the nodes the running spline went past, the last one is left to Update.
+         * @return False if an arrival stopped the creature or moved it elsewhere.
+         */
+        bool PassSplineNodes(Creature& creature);
+
         TimeTracker i_nextMoveTime; ///< Time tracker for the next move.
         bool m_isArrivalDone; ///< Indicates if the arrival is done.
         uint32 m_lastReachedWaypoint; ///< Last reached waypoint.
 
+        uint32 m_splineId; ///< Id of the spline launched by StartMove.
+        uint8 m_splineNodeCount; ///< Path nodes the spline runs to, starting with i_currentNode.
+        uint8 m_splineNodesPassed; ///< Of those, the nodes the creature went past.
+        int32 m_splineNodeEnds[WAYPOINT_SPLINE_MAX_NODES]; ///< Spline vertex of each of those nodes.
+
         int32 m_pathId; ///< Path ID.
         WaypointPathOrigin m_PathOrigin; ///< Path origin.
 };
@@ -63,7 +63,7 @@ void AggressorAI::MoveInLineOfSight(Unit* u)
             {
                 AttackStart(u);
             }
-            else if (sMapStore.LookupEntry(m_creature->GetMapId())->IsDungeon())
+            else if (sMapColumns.IsDungeon(m_creature->GetMapId()))
             {
                 m_creature->AddThreat(u);
                 u->SetInCombatWith(m_creature);
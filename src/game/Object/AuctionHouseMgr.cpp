@@ -477,6 +477,65 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id)
     return true;
 }
 
+// rows per multi-row INSERT, keeps a single statement well below max_allowed_packet
+#define AUCTION_SAVE_BATCH_ROWS 100
+
+void AuctionHouseMgr::SaveNewAuctionsToDB(std::vector<AuctionEntry*> const& auctions)
+{
+    if (auctions.empty())
+    {
+        return;
+    }
+
+    CharacterDatabase.BeginTransaction();
+
+    ItemSaveBatch items;
+    for (std::vector<AuctionEntry*>::const_iterator itr = auctions.begin(); itr != auctions.end(); ++itr)
+    {
+        if (Item* item = GetAItem((*itr)->itemGuidLow))
+        {
+            item->SaveToDB(&items);
+        }
+    }
+    items.Flush();
+
+    // No SQL injection (no strings)
+    std::ostringstream ss;
+    uint32 rows = 0;
+    for (std::vector<AuctionEntry*>::const_iterator itr = auctions.begin(); itr != auctions.end(); ++itr)
+    {
+        AuctionEntry const* auction = *itr;
+
+        if (rows == 0)
+        {
+            ss << "INSERT INTO `auction` (`id`,`houseid`,`itemguid`,`item_template`,`item_count`,`item_randompropertyid`,`itemowner`,`buyoutprice`,`time`,`buyguid`,`lastbid`,`startbid`,`deposit`) VALUES ";
+        }
+        else
+        {
+            ss << ",";
+        }
+
+        ss << "('" << auction->Id << "','" << auction->GetHouseId() << "','" << auction->itemGuidLow << "','" << auction->itemTemplate
+           << "','" << auction->itemCount << "','" << auction->itemRandomPropertyId << "','" << auction->owner << "','" << auction->buyout
+           << "','" << uint64(auction->expireTime) << "','" << auction->bidder << "','" << auction->bid << "','" << auction->startbid
+           << "','" << auction->deposit << "')";
+
+        if (++rows == AUCTION_SAVE_BATCH_ROWS)
+        {
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    if (rows)
+    {
+        CharacterDatabase.Execute(ss.str().c_str());
+    }
+
+    CharacterDatabase.CommitTransaction();
+}
+
 void AuctionHouseMgr::Update()
 {
     for (int i = 0; i < MAX_AUCTION_HOUSE_TYPE; ++i)
@@ -762,7 +821,7 @@ AuctionEntry* AuctionHouseObject::AddAuction(AuctionHouseEntry const* auctionHou
     return AH;
 }
 
-AuctionEntry* AuctionHouseObject::AddAuctionByGuid(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout, uint32 lowguid)
+AuctionEntry* AuctionHouseObject::AddAuctionByGuid(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout, uint32 lowguid, bool saveToDB)
 {
     uint32 auction_time = uint32(etime * sWorld.getConfig(CONFIG_FLOAT_RATE_AUCTION_TIME));
 
@@ -785,6 +844,12 @@ AuctionEntry* AuctionHouseObject::AddAuctionByGuid(AuctionHouseEntry const* auct
 
     sAuctionMgr.AddAItem(newItem);
 
+    // caller persists the auction later, e.g. through AuctionHouseMgr::SaveNewAuctionsToDB
+    if (!saveToDB)
+    {
+        return AH;
+    }
+
     CharacterDatabase.BeginTransaction();
 
     newItem->SaveToDB();
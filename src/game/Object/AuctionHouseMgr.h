@@ -152,7 +152,7 @@ class AuctionHouseObject
                                    uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
                                    uint32& count, uint32& totalcount);
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout = 0, uint32 deposit = 0, Player* pl = NULL);
-        AuctionEntry* AddAuctionByGuid(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout, uint32 lowguid);
+        AuctionEntry* AddAuctionByGuid(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout, uint32 lowguid, bool saveToDB = true);
     private:
         AuctionEntryMap AuctionsMap;
 };
@@ -209,6 +209,15 @@ class AuctionHouseMgr
         void AddAItem(Item* it);
         bool RemoveAItem(uint32 id);
 
+        /**
+         * @brief Persists a batch of freshly created auctions and their items in one transaction.
+         *
+         * Auction rows are written as multi-row INSERTs instead of one statement per auction.
+         *
+         * @param auctions Auctions added with AddAuctionByGuid(..., saveToDB = false).
+         */
+        void SaveNewAuctionsToDB(std::vector<AuctionEntry*> const& auctions);
+
         void Update();
 
     private:
@@ -104,9 +104,9 @@ bool Bag::Create(uint32 guidlow, uint32 itemid, Player const* owner)
     return true;
 }
 
-void Bag::SaveToDB()
+void Bag::SaveToDB(ItemSaveBatch* batch)
 {
-    Item::SaveToDB();
+    Item::SaveToDB(batch);
 }
 
 bool Bag::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
@@ -116,6 +116,23 @@ bool Bag::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
         return false;
     }
 
+    ClearSlotsAfterLoad();
+    return true;
+}
+
+bool Bag::LoadFromDB(ItemLoadData const& data, ObjectGuid ownerGuid)
+{
+    if (!Item::LoadFromDB(data, ownerGuid))
+    {
+        return false;
+    }
+
+    ClearSlotsAfterLoad();
+    return true;
+}
+
+void Bag::ClearSlotsAfterLoad()
+{
     // cleanup bag content related item value fields (its will be filled correctly from `character_inventory`)
     for (int i = 0; i < MAX_BAG_SIZE; ++i)
     {
@@ -124,8 +141,6 @@ bool Bag::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
         delete m_bagslot[i];
         m_bagslot[i] = NULL;
     }
-
-    return true;
 }
 
 void Bag::DeleteFromDB()
@@ -58,15 +58,17 @@ class Bag : public Item
 
         // DB operations
         // overwrite virtual Item::SaveToDB
-        void SaveToDB() override;
+        void SaveToDB(ItemSaveBatch* batch = NULL) override;
         // overwrite virtual Item::LoadFromDB
         bool LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid = ObjectGuid()) override;
+        bool LoadFromDB(ItemLoadData const& data, ObjectGuid ownerGuid) override;
         // overwrite virtual Item::DeleteFromDB
         void DeleteFromDB() override;
 
         void BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const override;
 
     protected:
+        void ClearSlotsAfterLoad();
 
         // Bag Storage space
         Item* m_bagslot[MAX_BAG_SIZE];
@@ -0,0 +1,617 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "CharacterDirectory.h"
+#include "Database/DatabaseEnv.h"
+#include "Database/DatabaseImpl.h"
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "Pet.h"
+#include "Player.h"
+#include "ProgressBar.h"
+#include "Util.h"
+#include "WorldPacket.h"
+#include "WorldSession.h"
+
+INSTANTIATE_SINGLETON_1(CharacterDirectory);
+
+static_assert(CHARACTER_DIRECTORY_EQUIPMENT_SLOTS == EQUIPMENT_SLOT_END, "directory must hold all equipment slots");
+
+// the same columns for the startup load and single character reloads
+#define CHARACTER_DIRECTORY_QUERY \
+    /*        0                     1                       2                    3                    4                     5 */ \
+    "SELECT `characters`.`guid`, `characters`.`account`, `characters`.`name`, `characters`.`race`, `characters`.`class`, `characters`.`gender`, " \
+    /*        6                           7                            8                     9                    10 */ \
+    "`characters`.`playerBytes`, `characters`.`playerBytes2`, `characters`.`level`, `characters`.`zone`, `characters`.`map`, " \
+    /*        11                         12                           13                           14 */ \
+    "`characters`.`position_x`, `characters`.`position_y`, `characters`.`position_z`, `guild_member`.`guildid`, " \
+    /*        15                          16                       17                    18                       19 */ \
+    "`characters`.`playerFlags`, `characters`.`at_login`, `character_pet`.`id`, `character_pet`.`entry`, `character_pet`.`modelid`, " \
+    /*        20                       21 */ \
+    "`character_pet`.`level`, `characters`.`equipmentCache` " \
+    "FROM `characters` LEFT JOIN `character_pet` ON `characters`.`guid` = `character_pet`.`owner` AND `character_pet`.`slot` = '%u' " \
+    "LEFT JOIN `guild_member` ON `characters`.`guid` = `guild_member`.`guid` " \
+    "WHERE `characters`.`deleteDate` IS NULL"
+
+CharacterDirectoryEntry::CharacterDirectoryEntry() :
+    guid(0), account(0), race(0), playerClass(0), gender(0), level(0),
+    playerBytes(0), playerBytes2(0), zone(0), map(0), x(0.0f), y(0.0f), z(0.0f),
+    guildId(0), playerFlags(0), atLoginFlags(0), petNumber(0), petEntry(0), petModelId(0), petLevel(0)
+{
+    memset(equipment, 0, sizeof(equipment));
+}
+
+CharacterDirectory::CharacterDirectory()
+{
+}
+
+void CharacterDirectory::LoadFromDB()
+{
+    QueryResult* result = CharacterDatabase.PQuery(CHARACTER_DIRECTORY_QUERY, uint32(PET_SAVE_AS_CURRENT));
+    QueryResult* deletedResult = CharacterDatabase.Query("SELECT `guid` FROM `characters` WHERE `deleteDate` IS NOT NULL");
+
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    m_entries.clear();
+    m_names.clear();
+    m_accounts.clear();
+    m_petOwners.clear();
+    m_deleted.clear();
+
+    if (deletedResult)
+    {
+        do
+        {
+            m_deleted.insert(deletedResult->Fetch()[0].GetUInt32());
+        }
+        while (deletedResult->NextRow());
+
+        delete deletedResult;
+    }
+
+    if (!result)
+    {
+        BarGoLink bar(1);
+        bar.step();
+        sLog.outString(">> Loaded 0 characters into the character directory");
+        sLog.outString();
+        return;
+    }
+
+    BarGoLink bar(result->GetRowCount());
+
+    do
+    {
+        bar.step();
+
+        CharacterDirectoryEntry entry;
+        LoadEntry(result->Fetch(), entry);
+        Insert(entry);
+    }
+    while (result->NextRow());
+
+    delete result;
+
+    sLog.outString(">> Loaded %u characters into the character directory", uint32(m_entries.size()));
+    sLog.outString();
+}
+
+void CharacterDirectory::ReloadCharacter(uint32 guidLow)
+{
+    CharacterDatabase.AsyncPQuery(&CharacterDirectory::HandleReloadCallback, guidLow,
+                                  CHARACTER_DIRECTORY_QUERY " AND `characters`.`guid` = '%u'", uint32(PET_SAVE_AS_CURRENT), guidLow);
+}
+
+void CharacterDirectory::HandleReloadCallback(QueryResult* result, uint32 guidLow)
+{
+    CharacterDirectory& directory = sCharacterDirectory;
+    ACE_WRITE_GUARD(LockType, guard, directory.m_lock)
+
+    EntryMap::iterator itr = directory.m_entries.find(guidLow);
+    if (itr != directory.m_entries.end())
+    {
+        directory.Erase(itr);
+    }
+
+    // no row: deleted, or unlinked from its account
+    if (!result)
+    {
+        return;
+    }
+
+    CharacterDirectoryEntry entry;
+    LoadEntry(result->Fetch(), entry);
+    directory.Insert(entry);
+    directory.m_deleted.erase(guidLow);                     // restored
+
+    delete result;
+}
+
+void CharacterDirectory::UpdateFromPlayer(Player* player)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    CharacterDirectoryEntry* entry;
+    EntryMap::iterator itr = m_entries.find(player->GetGUIDLow());
+    if (itr == m_entries.end())
+    {
+        CharacterDirectoryEntry newEntry;
+        newEntry.guid = player->GetGUIDLow();
+        newEntry.account = player->GetSession()->GetAccountId();
+        newEntry.name = player->GetName();
+        Insert(newEntry);
+        entry = &m_entries[newEntry.guid];
+    }
+    else
+    {
+        entry = &itr->second;
+        Rename(*entry, player->GetName());
+    }
+
+    // same values as Player::SaveToDB writes, pet data is kept up to date by the pet code
+    entry->race = player->getRace();
+    entry->playerClass = player->getClass();
+    entry->gender = player->getGender();
+    entry->level = player->getLevel();
+    entry->playerBytes = player->GetUInt32Value(PLAYER_BYTES);
+    entry->playerBytes2 = player->GetUInt32Value(PLAYER_BYTES_2);
+    entry->playerFlags = player->GetUInt32Value(PLAYER_FLAGS);
+    entry->zone = player->IsInWorld() ? player->GetZoneId() : player->GetCachedZoneId();
+    entry->guildId = player->GetGuildId();
+    entry->atLoginFlags = player->GetAtLoginFlags();
+
+    if (!player->IsBeingTeleported())
+    {
+        entry->map = player->GetMapId();
+        entry->x = player->GetPositionX();
+        entry->y = player->GetPositionY();
+        entry->z = player->GetPositionZ();
+    }
+    else
+    {
+        WorldLocation& dest = player->GetTeleportDest();
+        entry->map = dest.mapid;
+        entry->x = dest.coord_x;
+        entry->y = dest.coord_y;
+        entry->z = dest.coord_z;
+    }
+
+    for (uint32 i = 0; i < CHARACTER_DIRECTORY_EQUIPMENT_SLOTS; ++i)
+    {
+        entry->equipment[i] = player->GetUInt32Value(PLAYER_VISIBLE_ITEM_1_0 + i * MAX_VISIBLE_ITEM_OFFSET);
+    }
+}
+
+void CharacterDirectory::RemoveCharacter(uint32 guidLow, bool softDeleted)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        Erase(itr);
+    }
+
+    if (softDeleted)
+    {
+        m_deleted.insert(guidLow);
+    }
+    else
+    {
+        m_deleted.erase(guidLow);
+    }
+}
+
+void CharacterDirectory::SetName(uint32 guidLow, std::string const& name)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        Rename(itr->second, name);
+    }
+}
+
+void CharacterDirectory::SetLevel(uint32 guidLow, uint32 level)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        itr->second.level = level;
+    }
+}
+
+void CharacterDirectory::SetZone(uint32 guidLow, uint32 zone)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        itr->second.zone = zone;
+    }
+}
+
+void CharacterDirectory::SetPosition(uint32 guidLow, uint32 map, uint32 zone, float x, float y, float z)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        itr->second.map = map;
+        itr->second.zone = zone;
+        itr->second.x = x;
+        itr->second.y = y;
+        itr->second.z = z;
+    }
+}
+
+void CharacterDirectory::SetAtLoginFlags(uint32 guidLow, uint32 addFlags, uint32 removeFlags)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        itr->second.atLoginFlags = (itr->second.atLoginFlags | addFlags) & ~removeFlags;
+    }
+}
+
+void CharacterDirectory::AddAtLoginFlagsToAll(uint32 flags)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+    {
+        itr->second.atLoginFlags |= flags;
+    }
+}
+
+void CharacterDirectory::SetGuild(uint32 guidLow, uint32 guildId)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(guidLow);
+    if (itr != m_entries.end())
+    {
+        itr->second.guildId = guildId;
+    }
+}
+
+void CharacterDirectory::ClearGuild(uint32 guildId)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+    {
+        if (itr->second.guildId == guildId)
+        {
+            itr->second.guildId = 0;
+        }
+    }
+}
+
+void CharacterDirectory::SetCurrentPet(uint32 ownerGuidLow, uint32 petNumber, uint32 entry, uint32 modelId, uint32 level)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(ownerGuidLow);
+    if (itr != m_entries.end())
+    {
+        SetPet(itr->second, petNumber, entry, modelId, level);
+    }
+}
+
+void CharacterDirectory::ClearCurrentPet(uint32 ownerGuidLow, uint32 petNumber)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    EntryMap::iterator itr = m_entries.find(ownerGuidLow);
+    if (itr != m_entries.end() && (!petNumber || itr->second.petNumber == petNumber))
+    {
+        SetPet(itr->second, 0, 0, 0, 0);
+    }
+}
+
+void CharacterDirectory::RemovePet(uint32 petNumber)
+{
+    ACE_WRITE_GUARD(LockType, guard, m_lock)
+
+    PetOwnerMap::const_iterator owner = m_petOwners.find(petNumber);
+    if (owner == m_petOwners.end())
+    {
+        return;
+    }
+
+    EntryMap::iterator itr = m_entries.find(owner->second);
+    if (itr != m_entries.end())
+    {
+        SetPet(itr->second, 0, 0, 0, 0);
+    }
+    else
+    {
+        m_petOwners.erase(petNumber);
+    }
+}
+
+bool CharacterDirectory::GetCharacter(uint32 guidLow, CharacterDirectoryEntry& entry) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, false)
+
+    EntryMap::const_iterator itr = m_entries.find(guidLow);
+    if (itr == m_entries.end())
+    {
+        return false;
+    }
+
+    entry = itr->second;
+    return true;
+}
+
+bool CharacterDirectory::IsDeletedCharacter(uint32 guidLow) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, false)
+
+    return m_deleted.find(guidLow) != m_deleted.end();
+}
+
+bool CharacterDirectory::GetName(uint32 guidLow, std::string& name) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, false)
+
+    EntryMap::const_iterator itr = m_entries.find(guidLow);
+    if (itr == m_entries.end())
+    {
+        return false;
+    }
+
+    name = itr->second.name;
+    return true;
+}
+
+uint32 CharacterDirectory::GetAccountId(uint32 guidLow) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, 0)
+
+    EntryMap::const_iterator itr = m_entries.find(guidLow);
+    return itr != m_entries.end() ? itr->second.account : 0;
+}
+
+uint32 CharacterDirectory::GetGuidByName(std::string const& name) const
+{
+    std::string key;
+    if (!NameKey(name, key))
+    {
+        return 0;
+    }
+
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, 0)
+
+    NameMap::const_iterator itr = m_names.find(key);
+    return itr != m_names.end() ? itr->second : 0;
+}
+
+bool CharacterDirectory::GetGuidAndAccountByName(std::string const& name, uint32& guidLow, uint32& account) const
+{
+    std::string key;
+    if (!NameKey(name, key))
+    {
+        return false;
+    }
+
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, false)
+
+    NameMap::const_iterator nameItr = m_names.find(key);
+    if (nameItr == m_names.end())
+    {
+        return false;
+    }
+
+    EntryMap::const_iterator itr = m_entries.find(nameItr->second);
+    if (itr == m_entries.end())
+    {
+        return false;
+    }
+
+    guidLow = itr->first;
+    account = itr->second.account;
+    return true;
+}
+
+uint32 CharacterDirectory::GetCharacterCount(uint32 account) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, 0)
+
+    AccountMap::const_iterator itr = m_accounts.find(account);
+    return itr != m_accounts.end() ? uint32(itr->second.size()) : 0;
+}
+
+uint8 CharacterDirectory::BuildEnumData(uint32 account, WorldPacket& data) const
+{
+    ACE_READ_GUARD_RETURN(LockType, guard, m_lock, 0)
+
+    AccountMap::const_iterator itr = m_accounts.find(account);
+    if (itr == m_accounts.end())
+    {
+        return 0;
+    }
+
+    uint8 num = 0;
+    for (std::set<uint32>::const_iterator guidItr = itr->second.begin(); guidItr != itr->second.end(); ++guidItr)
+    {
+        EntryMap::const_iterator entry = m_entries.find(*guidItr);
+        if (entry == m_entries.end())
+        {
+            continue;
+        }
+
+        DETAIL_LOG("Build enum data for char guid %u from account %u.", *guidItr, account);
+        if (Player::BuildEnumData(entry->second, &data))
+        {
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+void CharacterDirectory::LoadEntry(Field* fields, CharacterDirectoryEntry& entry)
+{
+    entry.guid = fields[0].GetUInt32();
+    entry.account = fields[1].GetUInt32();
+    entry.name = fields[2].GetCppString();
+    entry.race = fields[3].GetUInt8();
+    entry.playerClass = fields[4].GetUInt8();
+    entry.gender = fields[5].GetUInt8();
+    entry.playerBytes = fields[6].GetUInt32();
+    entry.playerBytes2 = fields[7].GetUInt32();
+    entry.level = fields[8].GetUInt8();
+    entry.zone = fields[9].GetUInt32();
+    entry.map = fields[10].GetUInt32();
+    entry.x = fields[11].GetFloat();
+    entry.y = fields[12].GetFloat();
+    entry.z = fields[13].GetFloat();
+    entry.guildId = fields[14].GetUInt32();
+    entry.playerFlags = fields[15].GetUInt32();
+    entry.atLoginFlags = fields[16].GetUInt32();
+    entry.petNumber = fields[17].GetUInt32();
+    entry.petEntry = fields[18].GetUInt32();
+    entry.petModelId = fields[19].GetUInt32();
+    entry.petLevel = fields[20].GetUInt32();
+
+    // entry, enchantments pairs; only the entries are shown in the character list
+    Tokens tokens = StrSplit(fields[21].GetCppString(), " ");
+    for (uint32 i = 0; i < CHARACTER_DIRECTORY_EQUIPMENT_SLOTS; ++i)
+    {
+        entry.equipment[i] = i * 2 < tokens.size() ? uint32(atol(tokens[i * 2].c_str())) : 0;
+    }
+}
+
+bool CharacterDirectory::NameKey(std::string const& name, std::string& key)
+{
+    // names are unique ignoring case in the database, normalizing gives the same matches
+    key = name;
+    return normalizePlayerName(key);
+}
+
+void CharacterDirectory::Insert(CharacterDirectoryEntry const& entry)
+{
+    EntryMap::iterator itr = m_entries.find(entry.guid);
+    if (itr != m_entries.end())
+    {
+        Erase(itr);
+    }
+
+    m_entries[entry.guid] = entry;
+    m_accounts[entry.account].insert(entry.guid);
+
+    std::string key;
+    if (NameKey(entry.name, key))
+    {
+        m_names[key] = entry.guid;
+    }
+
+    if (entry.petNumber)
+    {
+        m_petOwners[entry.petNumber] = entry.guid;
+    }
+}
+
+void CharacterDirectory::Erase(EntryMap::iterator itr)
+{
+    CharacterDirectoryEntry const& entry = itr->second;
+
+    AccountMap::iterator account = m_accounts.find(entry.account);
+    if (account != m_accounts.end())
+    {
+        account->second.erase(entry.guid);
+        if (account->second.empty())
+        {
+            m_accounts.erase(account);
+        }
+    }
+
+    std::string key;
+    if (NameKey(entry.name, key))
+    {
+        NameMap::iterator name = m_names.find(key);
+        if (name != m_names.end() && name->second == entry.guid)
+        {
+            m_names.erase(name);
+        }
+    }
+
+    if (entry.petNumber)
+    {
+        m_petOwners.erase(entry.petNumber);
+    }
+
+    m_entries.erase(itr);
+}
+
+void CharacterDirectory::Rename(CharacterDirectoryEntry& entry, std::string const& name)
+{
+    if (entry.name == name)
+    {
+        return;
+    }
+
+    std::string key;
+    if (NameKey(entry.name, key))
+    {
+        NameMap::iterator itr = m_names.find(key);
+        if (itr != m_names.end() && itr->second == entry.guid)
+        {
+            m_names.erase(itr);
+        }
+    }
+
+    entry.name = name;
+    if (NameKey(entry.name, key))
+    {
+        m_names[key] = entry.guid;
+    }
+}
+
+void CharacterDirectory::SetPet(CharacterDirectoryEntry& entry, uint32 petNumber, uint32 petEntry, uint32 modelId, uint32 level)
+{
+    if (entry.petNumber)
+    {
+        m_petOwners.erase(entry.petNumber);
+    }
+
+    entry.petNumber = petNumber;
+    entry.petEntry = petEntry;
+    entry.petModelId = modelId;
+    entry.petLevel = level;
+
+    if (petNumber)
+    {
+        m_petOwners[petNumber] = entry.guid;
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_H_CHARACTERDIRECTORY
+#define MANGOS_H_CHARACTERDIRECTORY
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <ace/RW_Thread_Mutex.h>
+
+#include <set>
+
+class Field;
+class Player;
+class QueryResult;
+class WorldPacket;
+
+#define CHARACTER_DIRECTORY_EQUIPMENT_SLOTS 19              // EQUIPMENT_SLOT_END
+
+/**
+ * @brief Everything the character list and the offline name lookups need to know about one character.
+ */
+struct CharacterDirectoryEntry
+{
+    CharacterDirectoryEntry();
+
+    uint32 guid;
+    uint32 account;
+    std::string name;
+    uint8 race;
+    uint8 playerClass;
+    uint8 gender;
+    uint8 level;
+    uint32 playerBytes;
+    uint32 playerBytes2;
+    uint32 zone;
+    uint32 map;
+    float x;
+    float y;
+    float z;
+    uint32 guildId;
+    uint32 playerFlags;
+    uint32 atLoginFlags;
+    uint32 petNumber;                                       // current pet (slot 0), 0 if none
+    uint32 petEntry;
+    uint32 petModelId;
+    uint32 petLevel;
+    uint32 equipment[CHARACTER_DIRECTORY_EQUIPMENT_SLOTS];  // visible item entries
+};
+
+/**
+ * @brief In-memory copy of the `characters` rows of all existing characters.
+ *
+ * Deleted characters whose rows are kept (CharDelete.Method 1) are only
+ * remembered by guid, so name queries about them can still be answered.
+ *
+ * Loaded once at startup and kept current by the code that changes the rows
+ * (save, create, rename, delete, guild and pet changes, GM commands), so the
+ * character list and guid/name/account lookups for offline characters never
+ * have to query the character database. Changes made behind the server's back
+ * are picked up by ReloadCharacter(), which reads the row again after all
+ * queued writes.
+ *
+ * Map threads save players and look up names, so all access is guarded by a
+ * read/write lock and lookups return copies.
+ */
+class CharacterDirectory
+{
+    public:
+        CharacterDirectory();
+
+        void LoadFromDB();
+
+        /// Queues a read of the character's row after everything already queued for the character database.
+        void ReloadCharacter(uint32 guidLow);
+
+        void UpdateFromPlayer(Player* player);
+        /// @param softDeleted the row stays in the database unlinked from its account, see IsDeletedCharacter()
+        void RemoveCharacter(uint32 guidLow, bool softDeleted = false);
+
+        void SetName(uint32 guidLow, std::string const& name);
+        void SetLevel(uint32 guidLow, uint32 level);
+        void SetZone(uint32 guidLow, uint32 zone);
+        void SetPosition(uint32 guidLow, uint32 map, uint32 zone, float x, float y, float z);
+        void SetAtLoginFlags(uint32 guidLow, uint32 addFlags, uint32 removeFlags);
+        void AddAtLoginFlagsToAll(uint32 flags);
+        void SetGuild(uint32 guidLow, uint32 guildId);
+        void ClearGuild(uint32 guildId);
+        void SetCurrentPet(uint32 ownerGuidLow, uint32 petNumber, uint32 entry, uint32 modelId, uint32 level);
+        /// Forgets the current pet if it is @p petNumber, any current pet for 0.
+        void ClearCurrentPet(uint32 ownerGuidLow, uint32 petNumber);
+        void RemovePet(uint32 petNumber);
+
+        bool GetCharacter(uint32 guidLow, CharacterDirectoryEntry& entry) const;
+        /// Whether the character was deleted but its row is kept (mail senders, guild logs still refer to it).
+        bool IsDeletedCharacter(uint32 guidLow) const;
+        bool GetName(uint32 guidLow, std::string& name) const;
+        uint32 GetAccountId(uint32 guidLow) const;
+        /// @param name any case, as it would match in the database
+        uint32 GetGuidByName(std::string const& name) const;
+        /// Both values of the named character from one lookup, false if there is none.
+        bool GetGuidAndAccountByName(std::string const& name, uint32& guidLow, uint32& account) const;
+        uint32 GetCharacterCount(uint32 account) const;
+
+        /// Appends the SMSG_CHAR_ENUM entries of the account's characters, returns how many were written.
+        uint8 BuildEnumData(uint32 account, WorldPacket& data) const;
+
+    private:
+        typedef ACE_RW_Thread_Mutex LockType;
+        typedef UNORDERED_MAP<uint32, CharacterDirectoryEntry> EntryMap;
+        typedef UNORDERED_MAP<std::string, uint32> NameMap;
+        typedef UNORDERED_MAP<uint32, std::set<uint32> > AccountMap;   // ordered by guid like the old enum query
+        typedef UNORDERED_MAP<uint32, uint32> PetOwnerMap;
+        typedef UNORDERED_SET<uint32> GuidSet;
+
+        static void LoadEntry(Field* fields, CharacterDirectoryEntry& entry);
+        static bool NameKey(std::string const& name, std::string& key);
+        static void HandleReloadCallback(QueryResult* result, uint32 guidLow);
+
+        // called with m_lock held for writing
+        void Insert(CharacterDirectoryEntry const& entry);
+        void Erase(EntryMap::iterator itr);
+        void Rename(CharacterDirectoryEntry& entry, std::string const& name);
+        void SetPet(CharacterDirectoryEntry& entry, uint32 petNumber, uint32 petEntry, uint32 modelId, uint32 level);
+
+        mutable LockType m_lock;
+        EntryMap m_entries;
+        NameMap m_names;
+        AccountMap m_accounts;
+        PetOwnerMap m_petOwners;
+        GuidSet m_deleted;                                  // soft deleted characters, not in m_entries
+};
+
+#define sCharacterDirectory MaNGOS::Singleton<CharacterDirectory>::Instance()
+
+#endif
@@ -47,6 +47,7 @@
 #include "OutdoorPvP/OutdoorPvP.h"
 #include "Spell.h"
 #include "Util.h"
+#include "Utilities/SlabAllocator.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
 #include "CellImpl.h"
@@ -189,6 +190,16 @@ Creature::~Creature()
     i_AI = NULL;
 }
 
+void* Creature::operator new(size_t size)
+{
+    return SlabAllocator<Creature>::Instance().Allocate(size);
+}
+
+void Creature::operator delete(void* ptr, size_t size)
+{
+    SlabAllocator<Creature>::Instance().Deallocate(ptr, size);
+}
+
 void Creature::AddToWorld()
 {
 #ifdef ENABLE_ELUNA
@@ -658,6 +669,11 @@ void Creature::Update(uint32 update_diff, uint32 diff)
 
                 GetMap()->Add(this);
             }
+            else if (m_respawnTime > time(NULL) && HasStaticDBSpawnData())
+            {
+                // nothing to do before the respawn time, linked spawns are only rechecked after it
+                SleepUntil(m_respawnTime);
+            }
             break;
         }
         case CORPSE:
@@ -1887,6 +1903,8 @@ float Creature::GetAttackDistance(Unit const* pl) const
 
 void Creature::SetDeathState(DeathState s)
 {
+    WakeUp();
+
     if ((s == JUST_DIED && !m_IsDeadByDefault) || (s == JUST_ALIVED && m_IsDeadByDefault))
     {
         m_corpseRemoveTime = time(NULL) + m_corpseDelay; // the max/default time for corpse decay (before creature is looted/AllLootRemovedFromCorpse() is called)
@@ -1957,6 +1975,7 @@ void Creature::SetDeathState(DeathState s)
 
 void Creature::Respawn()
 {
+    WakeUp();
     RemoveCorpse();
     if (!IsInWorld())                                       // Could be removed as part of a pool (in which case respawn-time is handled with pool-system)
     {
@@ -2072,31 +2091,23 @@ SpellEntry const* Creature::ReachWithSpellAttack(Unit* pVictim)
         {
             continue;
         }
-        SpellEntry const* spellInfo = sSpellStore.LookupEntry(m_spells[i]);
-        if (!spellInfo)
+        if (!sSpellColumns.HasSpell(m_spells[i]))
         {
             sLog.outError("WORLD: unknown spell id %i", m_spells[i]);
             continue;
         }
 
-        bool bcontinue = true;
-        for (int j = 0; j < MAX_EFFECT_INDEX; ++j)
-        {
-            if ((spellInfo->Effect[j] == SPELL_EFFECT_SCHOOL_DAMAGE)       ||
-                (spellInfo->Effect[j] == SPELL_EFFECT_INSTAKILL)            ||
-                (spellInfo->Effect[j] == SPELL_EFFECT_ENVIRONMENTAL_DAMAGE) ||
-                (spellInfo->Effect[j] == SPELL_EFFECT_HEALTH_LEECH)
-               )
-            {
-                bcontinue = false;
-                break;
-            }
-        }
-        if (bcontinue)
+        // most creature spells fail the effect check, do it on the columns before touching the record
+        if (!sSpellColumns.HasEffect(m_spells[i], SPELL_EFFECT_SCHOOL_DAMAGE)       &&
+            !sSpellColumns.HasEffect(m_spells[i], SPELL_EFFECT_INSTAKILL)            &&
+            !sSpellColumns.HasEffect(m_spells[i], SPELL_EFFECT_ENVIRONMENTAL_DAMAGE) &&
+            !sSpellColumns.HasEffect(m_spells[i], SPELL_EFFECT_HEALTH_LEECH))
         {
             continue;
         }
 
+        SpellEntry const* spellInfo = sSpellStore.LookupEntry(m_spells[i]);
+
         if (spellInfo->manaCost > GetPower(POWER_MANA))
         {
             continue;
@@ -2139,18 +2150,19 @@ SpellEntry const* Creature::ReachWithSpellCure(Unit* pVictim)
         {
             continue;
         }
-        SpellEntry const* spellInfo = sSpellStore.LookupEntry(m_spells[i]);
-        if (!spellInfo)
+        if (!sSpellColumns.HasSpell(m_spells[i]))
         {
             sLog.outError("WORLD: unknown spell id %i", m_spells[i]);
             continue;
         }
 
-        if (!spellInfo->HasSpellEffect(SPELL_EFFECT_HEAL))
+        if (!sSpellColumns.HasEffect(m_spells[i], SPELL_EFFECT_HEAL))
         {
             continue;
         }
 
+        SpellEntry const* spellInfo = sSpellStore.LookupEntry(m_spells[i]);
+
         if (spellInfo->manaCost > GetPower(POWER_MANA))
         {
             continue;
@@ -2389,7 +2401,7 @@ bool Creature::IsOutOfThreatArea(Unit* pVictim) const
         return true;
     }
 
-    if (sMapStore.LookupEntry(GetMapId())->IsDungeon())
+    if (sMapColumns.IsDungeon(GetMapId()))
     {
         return false;
     }
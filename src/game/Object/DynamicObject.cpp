@@ -30,6 +30,7 @@
 #include "GridNotifiersImpl.h"
 #include "SpellMgr.h"
 #include "DBCStores.h"
+#include "Utilities/SlabAllocator.h"
 
 DynamicObject::DynamicObject() : WorldObject()
 {
@@ -40,6 +41,16 @@ DynamicObject::DynamicObject() : WorldObject()
     m_valuesCount = DYNAMICOBJECT_END;
 }
 
+void* DynamicObject::operator new(size_t size)
+{
+    return SlabAllocator<DynamicObject>::Instance().Allocate(size);
+}
+
+void DynamicObject::operator delete(void* ptr, size_t size)
+{
+    SlabAllocator<DynamicObject>::Instance().Deallocate(ptr, size);
+}
+
 void DynamicObject::AddToWorld()
 {
     ///- Register the dynamicObject for guid lookup
@@ -110,7 +121,7 @@ bool DynamicObject::Create(uint32 guidlow, Unit* caster, uint32 spellId, SpellEf
     m_radius = radius;
     m_effIndex = effIndex;
     m_spellId = spellId;
-    m_positive = IsPositiveEffect(spellProto, m_effIndex);
+    m_positive = IsPositiveEffect(spellProto->Id, m_effIndex);
 
     return true;
 }
@@ -43,6 +43,10 @@ class DynamicObject : public WorldObject
     public:
         explicit DynamicObject();
 
+        // one per area aura cast, allocated from a slab
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
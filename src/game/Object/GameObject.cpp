@@ -44,12 +44,14 @@
 #include "BattleGround/BattleGroundAV.h"
 #include "OutdoorPvP/OutdoorPvP.h"
 #include "Util.h"
+#include "Utilities/SlabAllocator.h"
 #include "ScriptMgr.h"
 #include "vmap/GameObjectModel.h"
 #include "CreatureAISelector.h"
 #include "SQLStorages.h"
 #include "GameObjectAI.h"
 #include <memory>
+#include <limits>
 
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
@@ -99,6 +101,16 @@ GameObject::~GameObject()
     delete m_model;
 }
 
+void* GameObject::operator new(size_t size)
+{
+    return SlabAllocator<GameObject>::Instance().Allocate(size);
+}
+
+void GameObject::operator delete(void* ptr, size_t size)
+{
+    SlabAllocator<GameObject>::Instance().Deallocate(ptr, size);
+}
+
 void GameObject::AddToWorld()
 {
 #ifdef ENABLE_ELUNA
@@ -720,7 +732,41 @@ void GameObject::Update(uint32 update_diff, uint32 p_time)
         AI()->UpdateAI(update_diff);   // AI not react good at real update delays (while freeze in non-active part of map)
         m_AI_locked = false;
     }
+    else if (CanSleep())
+    {
+        // idle until the respawn/despawn timer, or until used if there is none
+        SleepUntil(m_respawnTime ? m_respawnTime : std::numeric_limits<time_t>::max());
+    }
+}
+
+/**
+ * @brief Whether the next Update() calls would only wait for m_respawnTime.
+ *
+ * True for ready objects without AI that are not traps or fishing nodes and
+ * have charges left. Use, loot state and respawn time changes wake them up.
+ */
+bool GameObject::CanSleep() const
+{
+    if (m_lootState != GO_READY || m_AI)
+    {
+        return false;
+    }
+
+#ifdef ENABLE_ELUNA
+    if (GetEluna())
+    {
+        return false;
+    }
+#endif /* ENABLE_ELUNA */
+
+    GameObjectInfo const* goInfo = GetGOInfo();
+    if (goInfo->type == GAMEOBJECT_TYPE_TRAP || goInfo->type == GAMEOBJECT_TYPE_FISHINGNODE)
+    {
+        return false;
+    }
 
+    uint32 max_charges = goInfo->GetCharges();
+    return !max_charges || m_useTimes < max_charges;
 }
 
 void GameObject::Refresh()
@@ -1081,6 +1127,7 @@ bool GameObject::IsVisibleForInState(Player const* u, WorldObject const* viewPoi
 
 void GameObject::Respawn()
 {
+    WakeUp();
     if (m_spawnedByDefault && m_respawnTime > 0)
     {
         m_respawnTime = time(NULL);
@@ -2321,6 +2368,7 @@ uint32 GameObject::RollMineralVein(uint32 entry)      //Maybe incedicite bloodst
 void GameObject::SetLootState(LootState state)
 {
     m_lootState = state;
+    WakeUp();
 #ifdef ENABLE_ELUNA
     if (Eluna* e = GetEluna())
     {
@@ -560,6 +560,10 @@ class GameObject : public WorldObject
         explicit GameObject();
         ~GameObject();
 
+        // grid loading creates and destroys gameobjects in bulk, plain gameobjects come from a slab
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         void AddToWorld() override;
         void RemoveFromWorld() override;
 
@@ -629,6 +633,7 @@ class GameObject : public WorldObject
         {
             m_respawnTime = respawn > 0 ? time(NULL) + respawn : 0;
             m_respawnDelayTime = respawn > 0 ? uint32(respawn) : 0;
+            WakeUp();
         }
         void Respawn();
         bool isSpawned() const
@@ -683,7 +688,7 @@ class GameObject : public WorldObject
         }
 
         void AddUniqueUse(Player* player);
-        void AddUse() { ++m_useTimes; }
+        void AddUse() { ++m_useTimes; WakeUp(); }
 
         uint32 GetUseCount() const { return m_useTimes; }
         uint32 GetUniqueUseCount() const { return m_UniqueUsers.size(); }
@@ -780,6 +785,7 @@ class GameObject : public WorldObject
         std::unique_ptr<GameObjectAI> m_AI;
 
     private:
+        bool CanSleep() const;
         void SwitchDoorOrButton(bool activate, bool alternative = false);
         void TickCapturePoint();
         void UpdateModel();                                 // updates model in case displayId were changed
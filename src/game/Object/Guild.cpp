@@ -32,6 +32,7 @@
 #include "GuildMgr.h"
 #include "Chat.h"
 #include "SocialMgr.h"
+#include "CharacterDirectory.h"
 #include "Util.h"
 #include "Language.h"
 #include "World.h"
@@ -218,20 +219,17 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
     }
     else
     {
-        //                                                     0    1     2     3    4
-        QueryResult* result = CharacterDatabase.PQuery("SELECT `name`,`level`,`class`,`zone`,`account` FROM `characters` WHERE `guid` = '%u'", lowguid);
-        if (!result)
+        CharacterDirectoryEntry character;
+        if (!sCharacterDirectory.GetCharacter(lowguid, character))
         {
             return false; // player doesn't exist
         }
 
-        Field* fields    = result->Fetch();
-        newmember.Name   = fields[0].GetCppString();
-        newmember.Level  = fields[1].GetUInt8();
-        newmember.Class  = fields[2].GetUInt8();
-        newmember.ZoneId = fields[3].GetUInt32();
-        newmember.accountId = fields[4].GetInt32();
-        delete result;
+        newmember.Name   = character.name;
+        newmember.Level  = character.level;
+        newmember.Class  = character.playerClass;
+        newmember.ZoneId = character.zone;
+        newmember.accountId = character.account;
 
         if (newmember.Level < 1 || newmember.Level > STRONG_MAX_LEVEL ||
             !((1 << (newmember.Class - 1)) & CLASSMASK_ALL_PLAYABLE))
@@ -254,6 +252,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
 
     CharacterDatabase.PExecute("INSERT INTO `guild_member` (`guildid`,`guid`,`rank`,`pnote`,`offnote`) VALUES ('%u', '%u', '%u','%s','%s')",
                                m_Id, lowguid, newmember.RankId, dbPnote.c_str(), dbOFFnote.c_str());
+    sCharacterDirectory.SetGuild(lowguid, m_Id);
 
     // If player not in game data in data field will be loaded from guild tables, no need to update it!!
     if (pl)
@@ -479,6 +478,7 @@ bool Guild::LoadMembersFromDB(QueryResult* guildMembersResult)
             // there is in table guild_member record which doesn't have guildid in guild table, report error
             sLog.outErrorDb("Guild %u does not exist but it has a record in guild_member table, deleting it!", guildId);
             CharacterDatabase.PExecute("DELETE FROM `guild_member` WHERE `guildid` = '%u'", guildId);
+            sCharacterDirectory.ClearGuild(guildId);
             continue;
         }
 
@@ -513,6 +513,7 @@ bool Guild::LoadMembersFromDB(QueryResult* guildMembersResult)
         {
             sLog.outError("%s has a broken data in field `characters`.`data`, deleting him from guild!", newmember.guid.GetString().c_str());
             CharacterDatabase.PExecute("DELETE FROM `guild_member` WHERE `guid` = '%u'", lowguid);
+            sCharacterDirectory.SetGuild(lowguid, 0);
             continue;
         }
         if (!newmember.ZoneId)
@@ -526,6 +527,7 @@ bool Guild::LoadMembersFromDB(QueryResult* guildMembersResult)
         {
             sLog.outError("%s has a broken data in field `characters`.`class`, deleting him from guild!", newmember.guid.GetString().c_str());
             CharacterDatabase.PExecute("DELETE FROM `guild_member` WHERE `guid` = '%u'", lowguid);
+            sCharacterDirectory.SetGuild(lowguid, 0);
             continue;
         }
 
@@ -623,6 +625,7 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     }
 
     CharacterDatabase.PExecute("DELETE FROM `guild_member` WHERE `guid` = '%u'", lowguid);
+    sCharacterDirectory.SetGuild(lowguid, 0);
 
     if (!isDisbanding)
     {
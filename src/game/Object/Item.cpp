@@ -344,72 +344,65 @@ void Item::UpdateDuration(Player* owner, uint32 diff)
     SetState(ITEM_CHANGED, owner);                          // save new time in database
 }
 
-void Item::SaveToDB()
+void Item::SaveToDB(ItemSaveBatch* batch)
 {
+    ItemSaveBatch ownBatch;
+    ItemSaveBatch& rows = batch ? *batch : ownBatch;
+
     uint32 guid = GetGUIDLow();
     switch (uState)
     {
         case ITEM_NEW:
+        case ITEM_CHANGED:
         {
-            static SqlStatementID delItem ;
-            static SqlStatementID insItem ;
-
-            SqlStatement stmt = CharacterDatabase.CreateStatement(delItem, "DELETE FROM `item_instance` WHERE `guid` = ?");
-            stmt.PExecute(guid);
-
-            std::ostringstream ss;
-            for (uint16 i = 0; i < m_valuesCount; ++i)
+            // only the inventory record changed, e.g. moved inside the same bag
+            if (uState == ITEM_CHANGED && IsSavedStateCurrent())
             {
-                ss << GetUInt32Value(i) << " ";
+                break;
             }
 
-            stmt = CharacterDatabase.CreateStatement(insItem, "INSERT INTO `item_instance` (`guid`,`owner_guid`,`data`,`text`) VALUES (?, ?, ?, ?)");
-            stmt.PExecute(guid, GetOwnerGuid().GetCounter(), ss.str().c_str(), m_text.c_str());
-        } break;
-        case ITEM_CHANGED:
-        {
-            std::string text = m_text;
-            CharacterDatabase.escape_string(text);
-            static SqlStatementID updInstance ;
-            static SqlStatementID updGifts ;
-
-            SqlStatement stmt = CharacterDatabase.CreateStatement(updInstance, "UPDATE `item_instance` SET `data` = ?, `owner_guid` = ?, `text` = ? WHERE `guid` = ?");
-
             std::ostringstream ss;
             for (uint16 i = 0; i < m_valuesCount; ++i)
             {
                 ss << GetUInt32Value(i) << " ";
             }
 
-            stmt.PExecute(ss.str().c_str(), GetOwnerGuid().GetCounter(), m_text.c_str(), guid);
+            // replaces the row for new items, as the DELETE/INSERT pair did before
+            rows.AddItem(guid, GetOwnerGuid().GetCounter(), ss.str(), m_text);
+            StoreSavedState();
 
-            if (HasFlag(ITEM_FIELD_FLAGS, ITEM_DYNFLAG_WRAPPED))
+            if (uState == ITEM_CHANGED && HasFlag(ITEM_FIELD_FLAGS, ITEM_DYNFLAG_WRAPPED))
             {
-                stmt = CharacterDatabase.CreateStatement(updGifts, "UPDATE `character_gifts` SET `guid` = ? WHERE `item_guid` = ?");
+                static SqlStatementID updGifts ;
+
+                SqlStatement stmt = CharacterDatabase.CreateStatement(updGifts, "UPDATE `character_gifts` SET `guid` = ? WHERE `item_guid` = ?");
                 stmt.PExecute(GetOwnerGuid().GetCounter(), GetGUIDLow());
             }
         } break;
         case ITEM_REMOVED:
         {
-            static SqlStatementID delInst ;
             static SqlStatementID delGifts ;
             static SqlStatementID delLoot ;
 
-            SqlStatement stmt = CharacterDatabase.CreateStatement(delInst, "DELETE FROM `item_instance` WHERE `guid` = ?");
-            stmt.PExecute(guid);
+            rows.DeleteItem(guid);
 
             if (HasFlag(ITEM_FIELD_FLAGS, ITEM_DYNFLAG_WRAPPED))
             {
-                stmt = CharacterDatabase.CreateStatement(delGifts, "DELETE FROM `character_gifts` WHERE `item_guid` = ?");
+                SqlStatement stmt = CharacterDatabase.CreateStatement(delGifts, "DELETE FROM `character_gifts` WHERE `item_guid` = ?");
                 stmt.PExecute(GetGUIDLow());
             }
 
             if (HasSavedLoot())
             {
-                stmt = CharacterDatabase.CreateStatement(delLoot, "DELETE FROM `item_loot` WHERE `guid` = ?");
+                SqlStatement stmt = CharacterDatabase.CreateStatement(delLoot, "DELETE FROM `item_loot` WHERE `guid` = ?");
                 stmt.PExecute(GetGUIDLow());
             }
 
+            if (!batch)
+            {
+                ownBatch.Flush();
+            }
+
             delete this;
             return;
         }
@@ -417,6 +410,11 @@ void Item::SaveToDB()
             return;
     }
 
+    if (!batch)
+    {
+        ownBatch.Flush();
+    }
+
     if (m_lootState == ITEM_LOOT_CHANGED || m_lootState == ITEM_LOOT_REMOVED)
     {
         static SqlStatementID delLoot ;
@@ -491,6 +489,28 @@ bool Item::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
 
     SetText(fields[1].GetCppString());
 
+    return _LoadFromValues(guidLow, ownerGuid);
+}
+
+bool Item::LoadFromDB(ItemLoadData const& data, ObjectGuid ownerGuid)
+{
+    // create item before any checks for store correct guid
+    Object::_Create(data.guidLow, 0, HIGHGUID_ITEM);
+
+    if (!LoadValues(data.values))
+    {
+        sLog.outError("Item #%d have broken data in `data` field. Can't be loaded.", data.guidLow);
+        return false;
+    }
+
+    SetText(data.text);
+
+    return _LoadFromValues(data.guidLow, ownerGuid);
+}
+
+// fixups shared by both LoadFromDB, called once the values are set
+bool Item::_LoadFromValues(uint32 guidLow, ObjectGuid ownerGuid)
+{
     bool need_save = false;                                 // need explicit save data at load fixes
 
     // overwrite possible wrong/corrupted guid
@@ -575,6 +595,7 @@ bool Item::LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid)
         stmt.Execute();
     }
 
+    StoreSavedState();
     return true;
 }
 
@@ -614,6 +635,8 @@ void Item::DeleteFromDB()
 
     SqlStatement stmt = CharacterDatabase.CreateStatement(delItem, "DELETE FROM `item_instance` WHERE `guid` = ?");
     stmt.PExecute(GetGUIDLow());
+
+    m_savedValues.clear();
 }
 
 void Item::DeleteFromInventoryDB()
@@ -624,6 +647,19 @@ void Item::DeleteFromInventoryDB()
     stmt.PExecute(GetGUIDLow());
 }
 
+bool Item::IsSavedStateCurrent() const
+{
+    return m_savedValues.size() == m_valuesCount &&
+           memcmp(&m_savedValues[0], m_uint32Values, m_valuesCount * sizeof(uint32)) == 0 &&
+           m_savedText == m_text;
+}
+
+void Item::StoreSavedState()
+{
+    m_savedValues.assign(m_uint32Values, m_uint32Values + m_valuesCount);
+    m_savedText = m_text;
+}
+
 ItemPrototype const* Item::GetProto() const
 {
     return ObjectMgr::GetItemPrototype(GetEntry());
@@ -1287,3 +1323,133 @@ uint32 Item::GetScriptId() const
 {
     return sScriptMgr.GetBoundScriptId(SCRIPTED_ITEM, GetEntry());
 }
+
+// rows per multi-row statement, keeps a single statement well below max_allowed_packet
+#define ITEM_SAVE_BATCH_ROWS 100
+
+void ItemSaveBatch::AddItem(uint32 guidLow, uint32 ownerGuidLow, std::string const& data, std::string const& text)
+{
+    ItemRow row;
+    row.guidLow = guidLow;
+    row.ownerGuidLow = ownerGuidLow;
+    row.data = data;
+    row.text = text;
+    m_items.push_back(row);
+}
+
+void ItemSaveBatch::DeleteItem(uint32 guidLow)
+{
+    m_itemDeletes.push_back(guidLow);
+}
+
+void ItemSaveBatch::AddInventory(uint32 ownerGuidLow, uint32 bagGuidLow, uint8 slot, uint32 itemGuidLow, uint32 itemEntry)
+{
+    InventoryRow row;
+    row.ownerGuidLow = ownerGuidLow;
+    row.bagGuidLow = bagGuidLow;
+    row.slot = slot;
+    row.itemGuidLow = itemGuidLow;
+    row.itemEntry = itemEntry;
+    m_inventory.push_back(row);
+}
+
+void ItemSaveBatch::DeleteInventory(uint32 itemGuidLow)
+{
+    m_inventoryDeletes.push_back(itemGuidLow);
+}
+
+void ItemSaveBatch::Flush()
+{
+    // deletes first, a queued row never refers to a deleted item
+    FlushDeletes(m_inventoryDeletes, "character_inventory", "item");
+    FlushDeletes(m_itemDeletes, "item_instance", "guid");
+    FlushItems();
+    FlushInventory();
+}
+
+void ItemSaveBatch::FlushItems()
+{
+    if (m_items.size() == 1)
+    {
+        static SqlStatementID saveItem ;
+
+        ItemRow const& row = m_items[0];
+        SqlStatement stmt = CharacterDatabase.CreateStatement(saveItem, "INSERT INTO `item_instance` (`guid`,`owner_guid`,`data`,`text`) VALUES (?, ?, ?, ?) "
+                            "ON DUPLICATE KEY UPDATE `owner_guid` = VALUES(`owner_guid`), `data` = VALUES(`data`), `text` = VALUES(`text`)");
+        stmt.PExecute(row.guidLow, row.ownerGuidLow, row.data.c_str(), row.text.c_str());
+        m_items.clear();
+        return;
+    }
+
+    std::ostringstream ss;
+    uint32 rows = 0;
+    for (std::vector<ItemRow>::const_iterator itr = m_items.begin(); itr != m_items.end(); ++itr)
+    {
+        ss << (rows == 0 ? "INSERT INTO `item_instance` (`guid`,`owner_guid`,`data`,`text`) VALUES " : ",");
+
+        std::string text = itr->text;
+        CharacterDatabase.escape_string(text);
+        ss << "('" << itr->guidLow << "','" << itr->ownerGuidLow << "','" << itr->data << "','" << text << "')";
+
+        if (++rows == ITEM_SAVE_BATCH_ROWS || itr + 1 == m_items.end())
+        {
+            ss << " ON DUPLICATE KEY UPDATE `owner_guid` = VALUES(`owner_guid`), `data` = VALUES(`data`), `text` = VALUES(`text`)";
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    m_items.clear();
+}
+
+void ItemSaveBatch::FlushInventory()
+{
+    // No SQL injection (no strings)
+    std::ostringstream ss;
+    uint32 rows = 0;
+    for (std::vector<InventoryRow>::const_iterator itr = m_inventory.begin(); itr != m_inventory.end(); ++itr)
+    {
+        ss << (rows == 0 ? "INSERT INTO `character_inventory` (`guid`,`bag`,`slot`,`item`,`item_template`) VALUES " : ",");
+        ss << "('" << itr->ownerGuidLow << "','" << itr->bagGuidLow << "','" << uint32(itr->slot) << "','" << itr->itemGuidLow << "','" << itr->itemEntry << "')";
+
+        if (++rows == ITEM_SAVE_BATCH_ROWS || itr + 1 == m_inventory.end())
+        {
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    m_inventory.clear();
+}
+
+void ItemSaveBatch::FlushDeletes(std::vector<uint32>& guids, char const* table, char const* keyField)
+{
+    // No SQL injection (no strings)
+    std::ostringstream ss;
+    uint32 rows = 0;
+    for (std::vector<uint32>::const_iterator itr = guids.begin(); itr != guids.end(); ++itr)
+    {
+        if (rows == 0)
+        {
+            ss << "DELETE FROM `" << table << "` WHERE `" << keyField << "` IN (";
+        }
+        else
+        {
+            ss << ",";
+        }
+
+        ss << "'" << *itr << "'";
+
+        if (++rows == ITEM_SAVE_BATCH_ROWS || itr + 1 == guids.end())
+        {
+            ss << ")";
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    guids.clear();
+}
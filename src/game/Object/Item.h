@@ -220,6 +220,72 @@ enum ItemRequiredTargetType
 
 #define MAX_ITEM_REQ_TARGET_TYPE 2
 
+/**
+ * @brief An `item_instance` row read ahead, with the `data` field already split into values.
+ */
+struct ItemLoadData
+{
+    uint32 guidLow;
+    uint32 entry;
+    uint32 container;                                       // bag guid for inventory rows, mail id for mailed items
+    uint8 slot;
+    std::string text;
+    std::vector<uint32> values;
+};
+
+typedef std::vector<ItemLoadData> ItemLoadDataList;
+
+/**
+ * @brief Collects `item_instance` and `character_inventory` writes and sends them as multi-row statements.
+ *
+ * Item::SaveToDB() queues its row writes here, Player::_SaveInventory() also
+ * its inventory rows, and Flush() sends everything queued with one statement
+ * per ITEM_SAVE_BATCH_ROWS rows of a kind. Flush inside the transaction the
+ * saved item states belong to.
+ */
+class ItemSaveBatch
+{
+    public:
+        ItemSaveBatch() {}
+
+        void AddItem(uint32 guidLow, uint32 ownerGuidLow, std::string const& data, std::string const& text);
+        void DeleteItem(uint32 guidLow);
+        void AddInventory(uint32 ownerGuidLow, uint32 bagGuidLow, uint8 slot, uint32 itemGuidLow, uint32 itemEntry);
+        void DeleteInventory(uint32 itemGuidLow);
+
+        void Flush();
+
+    private:
+        struct ItemRow
+        {
+            uint32 guidLow;
+            uint32 ownerGuidLow;
+            std::string data;
+            std::string text;
+        };
+
+        struct InventoryRow
+        {
+            uint32 ownerGuidLow;
+            uint32 bagGuidLow;
+            uint8 slot;
+            uint32 itemGuidLow;
+            uint32 itemEntry;
+        };
+
+        ItemSaveBatch(ItemSaveBatch const&);
+        ItemSaveBatch& operator=(ItemSaveBatch const&);
+
+        void FlushItems();
+        void FlushInventory();
+        static void FlushDeletes(std::vector<uint32>& guids, char const* table, char const* keyField);
+
+        std::vector<ItemRow> m_items;
+        std::vector<uint32> m_itemDeletes;
+        std::vector<InventoryRow> m_inventory;
+        std::vector<uint32> m_inventoryDeletes;
+};
+
 struct ItemRequiredTarget
 {
     ItemRequiredTarget(ItemRequiredTargetType uiType, uint32 uiTargetEntry) : m_uiType(uiType), m_uiTargetEntry(uiTargetEntry) {}
@@ -253,8 +319,10 @@ class Item : public Object
         bool IsSoulBound() const { return HasFlag(ITEM_FIELD_FLAGS, ITEM_DYNFLAG_BINDED); }
         bool IsBindedNotWith(Player const* player) const;
         bool IsBoundByEnchant() const;
-        virtual void SaveToDB();
+        /// Writes the item's changes, queued into @p batch if given, else right away.
+        virtual void SaveToDB(ItemSaveBatch* batch = NULL);
         virtual bool LoadFromDB(uint32 guidLow, Field* fields, ObjectGuid ownerGuid = ObjectGuid());
+        virtual bool LoadFromDB(ItemLoadData const& data, ObjectGuid ownerGuid);
         virtual void DeleteFromDB();
         void DeleteFromInventoryDB();
         void LoadLootFromDB(Field* fields);
@@ -347,7 +415,15 @@ class Item : public Object
         void RemoveFromClientUpdateList() override;
         void BuildUpdateData(UpdateDataMapType& update_players) override;
     private:
+        bool _LoadFromValues(uint32 guidLow, ObjectGuid ownerGuid);
+
+        // values and text as last written to `item_instance`, ITEM_CHANGED saves are skipped while they match
+        bool IsSavedStateCurrent() const;
+        void StoreSavedState();
+
         std::string m_text;
+        std::vector<uint32> m_savedValues;                  // empty if the row is not known to match
+        std::string m_savedText;
         uint8 m_slot;
         Bag* m_container;
         ItemUpdateState uState;
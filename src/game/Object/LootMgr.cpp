@@ -83,10 +83,16 @@ class LootTemplate::LootGroup                               // A set of loot def
 
         void Verify(LootStore const& lootstore, uint32 id, uint32 group_id) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+        void Compile();                                     // Builds the alias table used by Roll() (after loading)
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+        // Vose alias table over every outcome of the group, a NULL outcome is an empty (or disabled) drop
+        std::vector<LootStoreItem const*> m_outcomes;
+        std::vector<float> m_aliasChance;                   // chance to keep the rolled column instead of taking its alias
+        std::vector<uint32> m_alias;
+
         LootStoreItem const* Roll() const;                  // Rolls an item from the group, returns NULL if all miss their chances
 };
 
@@ -110,6 +116,16 @@ void LootStore::Verify() const
     }
 }
 
+// Prepares every template of the store for rolling
+// Referenced templates are resolved here, so all stores must be compiled again when the reference store changes
+void LootStore::Compile()
+{
+    for (LootTemplateMap::const_iterator i = m_LootTemplates.begin(); i != m_LootTemplates.end(); ++i)
+    {
+        i->second->Compile();
+    }
+}
+
 // Loads a *_loot_template DB table into loot store
 // All checks of the loaded template are called from here, no error reports at loot generation required
 void LootStore::LoadLootTable()
@@ -193,6 +209,7 @@ void LootStore::LoadLootTable()
         delete result;
 
         Verify();                                           // Checks validity of the loot store
+        Compile();                                          // Builds the roll tables
 
         sLog.outString(">> Loaded %u loot definitions (%zu templates) from table %s", count, m_LootTemplates.size(), GetName());
         sLog.outString();
@@ -522,7 +539,7 @@ void Loot::AddItem(LootStoreItem const& item)
             m_questItems.push_back(LootItem(item));
         }
     }
-    else if (items.size() < MAX_NR_LOOT_ITEMS && !DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, item.itemid))              // Non-quest drop
+    else if (items.size() < MAX_NR_LOOT_ITEMS)              // Non-quest drop, disabled drops never reach here (filtered at compile)
     {
         items.push_back(LootItem(item));
 
@@ -1022,30 +1039,106 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem& item)
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll() const
 {
-    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
+    if (m_outcomes.empty())
+    {
+        return NULL;
+    }
+
+    // single roll: the integer part picks the column, the fraction decides between column and alias
+    float roll = rand_norm_f() * m_outcomes.size();
+    uint32 column = std::min(uint32(roll), uint32(m_outcomes.size() - 1));
+
+    return (roll - column) < m_aliasChance[column] ? m_outcomes[column] : m_outcomes[m_alias[column]];
+}
+
+// Builds the alias table from the group entries
+// Outcome chances follow the DB semantics: explicitly chanced entries are taken in order until 100% is used up,
+// the rest is shared by the equal chanced entries or is an empty drop
+void LootTemplate::LootGroup::Compile()
+{
+    m_outcomes.clear();
+    m_aliasChance.clear();
+    m_alias.clear();
+
+    std::vector<float> chances;
+    float remaining = 100.0f;
+
+    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end() && remaining > 0.0f; ++i)
     {
-        float Roll = rand_chance_f();
+        float chance = i->chance >= 100.0f ? remaining : std::min(i->chance, remaining);
+        remaining -= chance;
+
+        m_outcomes.push_back(DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, i->itemid) ? NULL : &*i);
+        chances.push_back(chance);
+    }
 
-        for (uint32 i = 0; i < ExplicitlyChanced.size(); ++i) // check each explicitly chanced entry in the template and modify its chance based on quality.
+    if (remaining > 0.0f)
+    {
+        if (!EqualChanced.empty())
         {
-            if (ExplicitlyChanced[i].chance >= 100.0f)
+            float chance = remaining / EqualChanced.size();
+            for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
             {
-                return &ExplicitlyChanced[i];
+                m_outcomes.push_back(DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, i->itemid) ? NULL : &*i);
+                chances.push_back(chance);
             }
+        }
+        else
+        {
+            m_outcomes.push_back(NULL);
+            chances.push_back(remaining);
+        }
+    }
 
-            Roll -= ExplicitlyChanced[i].chance;
-            if (Roll < 0)
-            {
-                return &ExplicitlyChanced[i];
-            }
+    uint32 size = m_outcomes.size();
+    m_aliasChance.resize(size, 1.0f);
+    m_alias.resize(size, 0);
+
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        chances[i] = chances[i] * size / 100.0f;            // scale so that the average column holds 1.0
+        m_alias[i] = i;
+        if (chances[i] < 1.0f)
+        {
+            small.push_back(i);
+        }
+        else
+        {
+            large.push_back(i);
         }
     }
-    if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
+
+    while (!small.empty() && !large.empty())
     {
-        return &EqualChanced[irand(0, EqualChanced.size() - 1)];
+        uint32 less = small.back();
+        small.pop_back();
+        uint32 more = large.back();
+        large.pop_back();
+
+        m_aliasChance[less] = chances[less];
+        m_alias[less] = more;
+
+        chances[more] = (chances[more] + chances[less]) - 1.0f;
+        if (chances[more] < 1.0f)
+        {
+            small.push_back(more);
+        }
+        else
+        {
+            large.push_back(more);
+        }
     }
 
-    return NULL;                                            // Empty drop from the group
+    // whatever is left is 1.0 up to float rounding, those columns never use their alias
+    for (uint32 i = 0; i < small.size(); ++i)
+    {
+        m_aliasChance[small[i]] = 1.0f;
+    }
+    for (uint32 i = 0; i < large.size(); ++i)
+    {
+        m_aliasChance[large[i]] = 1.0f;
+    }
 }
 
 // True if group includes at least 1 quest drop entry
@@ -1140,8 +1233,7 @@ bool LootTemplate::LootGroup::HasStartingQuestDropForPlayer(Player const* player
 // Rolls an item from the group (if any takes its chance) and adds the item to the loot
 void LootTemplate::LootGroup::Process(Loot& loot) const
 {
-    LootStoreItem const* item = Roll();
-    if (item != NULL && !DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, item->itemid))
+    if (LootStoreItem const* item = Roll())                 // disabled drops are NULL outcomes already
     {
         loot.AddItem(*item);
     }
@@ -1256,37 +1348,34 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, bool rate, uint8
         return;
     }
 
-    // Rolling non-grouped items
-    for (LootStoreItemList::const_iterator i = Entries.begin() ; i != Entries.end() ; ++i)
+    // Rolling non-grouped items, disabled drops and missing references are already left out
+    for (CompiledEntryList::const_iterator i = m_compiledEntries.begin() ; i != m_compiledEntries.end() ; ++i)
     {
-        if (DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, i->itemid) || !i->Roll(rate))
-        {
-            continue; // Bad luck for the entry
-        }
-
-        if (i->mincountOrRef < 0)                           // References processing
+        if (i->chance < 100.0f)
         {
-            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
-
-            if (!Referenced)
+            float chance = rate && i->rateIndex >= 0 ? i->chance * sWorld.getConfig(eConfigFloatValues(i->rateIndex)) : i->chance;
+            if (!roll_chance_f(chance))
             {
-                continue; // Error message already printed at loading stage
+                continue; // Bad luck for the entry
             }
+        }
 
+        if (i->reference)                                   // References processing
+        {
             // Check condition
-            if (i->conditionId && !sObjectMgr.IsPlayerMeetToCondition(i->conditionId, NULL, NULL, loot.GetLootTarget(), CONDITION_FROM_REFERING_LOOT))
+            if (i->item->conditionId && !sObjectMgr.IsPlayerMeetToCondition(i->item->conditionId, NULL, NULL, loot.GetLootTarget(), CONDITION_FROM_REFERING_LOOT))
             {
                 continue;
             }
 
-            for (uint32 loop = 0; loop < i->maxcount; ++loop) // Ref multiplicator
+            for (uint32 loop = 0; loop < i->item->maxcount; ++loop) // Ref multiplicator
             {
-                Referenced->Process(loot, store, rate, i->group);
+                i->reference->Process(loot, store, rate, i->item->group);
             }
         }
         else                                                // Plain entries (not a reference, not grouped)
         {
-            loot.AddItem(*i); // Chance is already checked, just add
+            loot.AddItem(*i->item); // Chance is already checked, just add
         }
     }
 
@@ -1297,6 +1386,50 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, bool rate, uint8
     }
 }
 
+// Builds the flat entry list and the group alias tables
+// Item quality rates are resolved to their config index here, the config values themselves are read at roll time
+void LootTemplate::Compile()
+{
+    m_compiledEntries.clear();
+    m_compiledEntries.reserve(Entries.size());
+
+    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    {
+        if (DisableMgr::IsDisabledFor(DISABLE_TYPE_ITEM_DROP, i->itemid))
+        {
+            continue;
+        }
+
+        CompiledEntry entry;
+        entry.item = &*i;
+        entry.reference = NULL;
+        entry.chance = i->chance;
+        entry.rateIndex = -1;
+
+        if (i->mincountOrRef < 0)                           // reference case
+        {
+            entry.reference = LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
+            if (!entry.reference)
+            {
+                continue;                                   // Error message already printed at loading stage
+            }
+
+            entry.rateIndex = CONFIG_FLOAT_RATE_DROP_ITEM_REFERENCED;
+        }
+        else if (ItemPrototype const* pProto = ObjectMgr::GetItemPrototype(i->itemid))
+        {
+            entry.rateIndex = qualityToRate[pProto->Quality];
+        }
+
+        m_compiledEntries.push_back(entry);
+    }
+
+    for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
+    {
+        i->Compile();
+    }
+}
+
 // True if template includes at least 1 quest drop entry
 bool LootTemplate::HasQuestDrop(LootTemplateMap const& store, uint8 groupId) const
 {
@@ -1757,4 +1890,46 @@ void LoadLootTemplates_Reference()
 
     // output error for any still listed ids (not referenced from any loot table)
     LootTemplates_Reference.ReportUnusedIds(ids_set);
+
+    // all stores hold pointers into the reference store
+    CompileLootTables();
+}
+
+void CompileLootTables()
+{
+    LootTemplates_Creature.Compile();
+    LootTemplates_Fishing.Compile();
+    LootTemplates_Gameobject.Compile();
+    LootTemplates_Item.Compile();
+    LootTemplates_Mail.Compile();
+    LootTemplates_Pickpocketing.Compile();
+    LootTemplates_Skinning.Compile();
+    LootTemplates_Disenchant.Compile();
+    LootTemplates_Reference.Compile();
+}
+
+uint32 SimulateLoot(LootStore const& store, uint32 loot_id, uint32 count, std::map<uint32, uint32>& drops)
+{
+    LootTemplate const* tab = store.GetLootFor(loot_id);
+    if (!tab)
+    {
+        return 0;
+    }
+
+    uint32 startTime = getMSTime();
+
+    Loot loot(NULL);
+    loot.items.reserve(MAX_NR_LOOT_ITEMS);
+    for (uint32 i = 0; i < count; ++i)
+    {
+        loot.clear();
+        tab->Process(loot, store, store.IsRatesAllowed());
+
+        for (LootItemList::const_iterator itr = loot.items.begin(); itr != loot.items.end(); ++itr)
+        {
+            ++drops[itr->itemid];
+        }
+    }
+
+    return std::max(getMSTimeDiff(startTime, getMSTime()), uint32(1));
 }
@@ -185,6 +185,9 @@ class LootStore
         char const* GetName() const { return m_name; }
         char const* GetEntryName() const { return m_entryName; }
         bool IsRatesAllowed() const { return m_ratesAllowed; }
+
+        // Rebuilds the roll tables of all templates, required after references or disables changed
+        void Compile();
     protected:
         void LoadLootTable();
         void Clear();
@@ -234,9 +237,22 @@ class LootTemplate
         // Checks integrity of the template
         void Verify(LootStore const& store, uint32 Id) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+
+        // Builds the flat roll tables used by Process() out of the loaded entries
+        void Compile();
     private:
+        struct CompiledEntry                                // Non-grouped entry prepared for rolling
+        {
+            LootStoreItem const* item;                      // source entry, added to the loot as is
+            LootTemplate const* reference;                  // resolved reference template, NULL for plain entries
+            float chance;                                   // chance to drop without rates applied
+            int32 rateIndex;                                // eConfigFloatValues applied to the chance if rates are allowed, -1 for none
+        };
+        typedef std::vector<CompiledEntry> CompiledEntryList;
+
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
+        CompiledEntryList m_compiledEntries;                // Entries without disabled drops and with references resolved
 };
 
 //=====================================================
@@ -399,6 +415,11 @@ void LoadLootTemplates_Disenchant();
 
 void LoadLootTemplates_Reference();
 
+void CompileLootTables();
+
+// Rolls loot_id of the store count times, collecting how often every non-quest item dropped (item id -> times)
+uint32 SimulateLoot(LootStore const& store, uint32 loot_id, uint32 count, std::map<uint32, uint32>& drops);
+
 inline void LoadLootTables()
 {
     LoadLootTemplates_Creature();
@@ -572,6 +572,22 @@ bool Object::LoadValues(const char* data)
     return true;
 }
 
+bool Object::LoadValues(std::vector<uint32> const& values)
+{
+    if (!m_uint32Values)
+    {
+        _InitValues();
+    }
+
+    if (values.size() != m_valuesCount)
+    {
+        return false;
+    }
+
+    std::copy(values.begin(), values.end(), m_uint32Values);
+    return true;
+}
+
 void Object::_SetUpdateBits(UpdateMask* updateMask, Player* /*target*/) const
 {
     for (uint16 index = 0; index < m_valuesCount; ++index)
@@ -913,7 +929,7 @@ WorldObject::WorldObject() :
 #endif /* ENABLE_ELUNA */
     m_currMap(NULL),
     m_mapId(0), m_InstanceId(0),
-    m_isActiveObject(false)
+    m_skippedUpdateTime(0), m_sleepUntil(0), m_isActiveObject(false)
 {
 }
 
@@ -432,6 +432,7 @@ class Object
         void ClearUpdateMask(bool remove);
 
         bool LoadValues(const char* data);
+        bool LoadValues(std::vector<uint32> const& values);
 
         uint16 GetValuesCount() const { return m_valuesCount; }
 
@@ -506,10 +507,15 @@ class WorldObject : public Object
 
                 void Update(uint32 time_diff)
                 {
+                    time_diff += m_obj->m_skippedUpdateTime;
+                    m_obj->m_skippedUpdateTime = 0;
                     m_obj->Update(m_obj->m_updateTracker.timeElapsed(), time_diff);
                     m_obj->m_updateTracker.Reset();
                 }
 
+                /// Leaves out this tick, the next Update() passes its time on as well.
+                void Skip(uint32 time_diff) { m_obj->m_skippedUpdateTime += time_diff; }
+
             private:
                 UpdateHelper(const UpdateHelper&);
                 UpdateHelper& operator=(const UpdateHelper&);
@@ -685,6 +691,16 @@ class WorldObject : public Object
 
         void SetActiveObjectState(bool active);
 
+        /**
+         * @brief Leaves the object out of the map updates until @p wakeTime.
+         *
+         * For objects with nothing to do until a known time (respawn, despawn).
+         * Anything that gives the object work earlier must call WakeUp().
+         */
+        void SleepUntil(time_t wakeTime) { m_sleepUntil = wakeTime; }
+        void WakeUp() { m_sleepUntil = 0; }
+        bool IsSleeping(time_t now) const { return m_sleepUntil > now; }
+
         ViewPoint& GetViewPoint() { return m_viewPoint; }
 
         // ASSERT print helper
@@ -722,6 +738,8 @@ class WorldObject : public Object
         Position m_position;
         ViewPoint m_viewPoint;
         WorldUpdateCounter m_updateTracker;
+        uint32 m_skippedUpdateTime;                         // ticks left out by the update LOD, see UpdateHelper::Skip()
+        time_t m_sleepUntil;                                // no updates before this time, 0 if awake
         bool m_isActiveObject;
 };
 
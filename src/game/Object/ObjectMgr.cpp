@@ -45,6 +45,7 @@
 #include "Util.h"
 #include "GossipDef.h"
 #include "Mail.h"
+#include "CharacterDirectory.h"
 #include "Formulas.h"
 #include "InstanceData.h"
 #include "GridNotifiers.h"
@@ -1698,62 +1699,38 @@ void ObjectMgr::RemoveGameobjectFromGrid(uint32 guid, GameObjectData const* data
 // name must be checked to correctness (if received) before call this function
 ObjectGuid ObjectMgr::GetPlayerGuidByName(std::string name) const
 {
-    ObjectGuid guid;
-
-    CharacterDatabase.escape_string(name);
-
-    // Player name safe to sending to DB (checked at login) and this function using
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `guid` FROM `characters` WHERE `name` = '%s'", name.c_str());
-    if (result)
+    if (uint32 lowguid = sCharacterDirectory.GetGuidByName(name))
     {
-        guid = ObjectGuid(HIGHGUID_PLAYER, (*result)[0].GetUInt32());
-
-        delete result;
+        return ObjectGuid(HIGHGUID_PLAYER, lowguid);
     }
 
-    return guid;
+    return ObjectGuid();
 }
 
 bool ObjectMgr::GetPlayerNameByGUID(ObjectGuid guid, std::string& name) const
 {
-    // prevent DB access for online player
+    // prevent directory lock for online player
     if (Player* player = GetPlayer(guid))
     {
         name = player->GetName();
         return true;
     }
 
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `name` FROM `characters` WHERE `guid` = '%u'", lowguid);
-
-    if (result)
-    {
-        name = (*result)[0].GetCppString();
-        delete result;
-        return true;
-    }
-
-    return false;
+    return sCharacterDirectory.GetName(guid.GetCounter(), name);
 }
 
 Team ObjectMgr::GetPlayerTeamByGUID(ObjectGuid guid) const
 {
-    // prevent DB access for online player
+    // prevent directory lock for online player
     if (Player* player = GetPlayer(guid))
     {
         return Player::TeamForRace(player->getRace());
     }
 
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `race` FROM `characters` WHERE `guid` = '%u'", lowguid);
-
-    if (result)
+    CharacterDirectoryEntry character;
+    if (sCharacterDirectory.GetCharacter(guid.GetCounter(), character))
     {
-        uint8 race = (*result)[0].GetUInt8();
-        delete result;
-        return Player::TeamForRace(race);
+        return Player::TeamForRace(character.race);
     }
 
     return TEAM_NONE;
@@ -1761,21 +1738,16 @@ Team ObjectMgr::GetPlayerTeamByGUID(ObjectGuid guid) const
 
 uint8 ObjectMgr::GetPlayerClassByGUID(ObjectGuid guid) const
 {
-    // prevent DB access for online player
+    // prevent directory lock for online player
     if (Player* player = GetPlayer(guid))
     {
         return player->getClass();
     }
 
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `class` FROM `characters` WHERE `guid` = '%u'", lowguid);
-
-    if (result)
+    CharacterDirectoryEntry character;
+    if (sCharacterDirectory.GetCharacter(guid.GetCounter(), character))
     {
-        uint8 pClass = (*result)[0].GetUInt8();
-        delete result;
-        return pClass;
+        return character.playerClass;
     }
 
     return 0;
@@ -1788,36 +1760,19 @@ uint32 ObjectMgr::GetPlayerAccountIdByGUID(ObjectGuid guid) const
         return 0;
     }
 
-    // prevent DB access for online player
+    // prevent directory lock for online player
     if (Player* player = GetPlayer(guid))
     {
         return player->GetSession()->GetAccountId();
     }
 
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `account` FROM `characters` WHERE `guid` = '%u'", lowguid);
-    if (result)
-    {
-        uint32 acc = (*result)[0].GetUInt32();
-        delete result;
-        return acc;
-    }
-
-    return 0;
+    return sCharacterDirectory.GetAccountId(guid.GetCounter());
 }
 
 uint32 ObjectMgr::GetPlayerAccountIdByPlayerName(const std::string& name) const
 {
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `account` FROM `characters` WHERE `name` = '%s'", name.c_str());
-    if (result)
-    {
-        uint32 acc = (*result)[0].GetUInt32();
-        delete result;
-        return acc;
-    }
-
-    return 0;
+    uint32 lowguid, account;
+    return sCharacterDirectory.GetGuidAndAccountByName(name, lowguid, account) ? account : 0;
 }
 
 void ObjectMgr::LoadItemLocales()
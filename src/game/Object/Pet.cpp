@@ -27,6 +27,7 @@
 #include "Log.h"
 #include "WorldPacket.h"
 #include "ObjectMgr.h"
+#include "CharacterDirectory.h"
 #include "SpellMgr.h"
 #include "Formulas.h"
 #include "SpellAuras.h"
@@ -283,6 +284,8 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
         stmt.PExecute(uint32(PET_SAVE_AS_CURRENT), ownerid, m_charmInfo->GetPetNumber());
 
         CharacterDatabase.CommitTransaction();
+
+        sCharacterDirectory.SetCurrentPet(ownerid, m_charmInfo->GetPetNumber(), petentry, fields[3].GetUInt32(), fields[4].GetUInt32());
     }
 
     // load action bar, if data broken will fill later by default spells.
@@ -528,6 +531,17 @@ void Pet::SavePetToDB(PetSaveMode mode)
 
         savePet.Execute();
         CharacterDatabase.CommitTransaction();
+
+        // keep the pet shown in the character list in sync with the current slot
+        if (mode == PET_SAVE_AS_CURRENT)
+        {
+            sCharacterDirectory.SetCurrentPet(ownerLow, m_charmInfo->GetPetNumber(), GetEntry(), GetNativeDisplayId(), getLevel());
+        }
+        else
+        {
+            // a hunter pet saved out of the stable removed whatever pet was current
+            sCharacterDirectory.ClearCurrentPet(ownerLow, getPetType() == HUNTER_PET && mode > PET_SAVE_LAST_STABLE_SLOT ? 0 : m_charmInfo->GetPetNumber());
+        }
     }
     else
     {
@@ -550,6 +564,7 @@ void Pet::DeleteFromDB(uint32 guidlow, bool separate_transaction)
 
     SqlStatement stmt = CharacterDatabase.CreateStatement(delPet, "DELETE FROM `character_pet` WHERE `id` = ?");
     stmt.PExecute(guidlow);
+    sCharacterDirectory.RemovePet(guidlow);
 
     stmt = CharacterDatabase.CreateStatement(delAuras, "DELETE FROM `pet_aura` WHERE `guid` = ?");
     stmt.PExecute(guidlow);
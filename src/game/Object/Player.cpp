@@ -63,6 +63,7 @@
 #include "Spell.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "CharacterDirectory.h"
 #include "Mail.h"
 #include "DBCStores.h"
 #include "SQLStorages.h"
@@ -1688,56 +1689,46 @@ void Player::SetDeathState(DeathState s)
     }
 }
 
-bool Player::BuildEnumData(QueryResult* result, WorldPacket* p_data)
+bool Player::BuildEnumData(CharacterDirectoryEntry const& character, WorldPacket* p_data)
 {
-    //             0               1                2                3                 4                  5                       6                        7
-    //    "SELECT characters.guid, characters.name, characters.race, characters.class, characters.gender, characters.playerBytes, characters.playerBytes2, characters.level, "
-    //     8                9               10                     11                     12                     13                    14
-    //    "characters.zone, characters.map, characters.position_x, characters.position_y, characters.position_z, guild_member.guildid, characters.playerFlags, "
-    //    15                    16                   17                     18                   19
-    //    "characters.at_login, character_pet.entry, character_pet.modelid, character_pet.level, characters.equipmentCache "
-
-    Field* fields = result->Fetch();
-
-    uint32 guid = fields[0].GetUInt32();
-    uint8 pRace = fields[2].GetUInt8();
-    uint8 pClass = fields[3].GetUInt8();
+    uint8 pRace = character.race;
+    uint8 pClass = character.playerClass;
 
     PlayerInfo const* info = sObjectMgr.GetPlayerInfo(pRace, pClass);
     if (!info)
     {
-        sLog.outError("Player %u has incorrect race/class pair. Don't build enum.", guid);
+        sLog.outError("Player %u has incorrect race/class pair. Don't build enum.", character.guid);
         return false;
     }
 
-    *p_data << ObjectGuid(HIGHGUID_PLAYER, guid);
-    *p_data << fields[1].GetString();                       // name
+    *p_data << ObjectGuid(HIGHGUID_PLAYER, character.guid);
+    *p_data << character.name;                              // name
     *p_data << uint8(pRace);                                // race
     *p_data << uint8(pClass);                               // class
-    *p_data << uint8(fields[4].GetUInt8());                 // gender
+    *p_data << uint8(character.gender);                     // gender
 
-    uint32 playerBytes = fields[5].GetUInt32();
+    uint32 playerBytes = character.playerBytes;
     *p_data << uint8(playerBytes);                          // skin
     *p_data << uint8(playerBytes >> 8);                     // face
     *p_data << uint8(playerBytes >> 16);                    // hair style
     *p_data << uint8(playerBytes >> 24);                    // hair color
 
-    uint32 playerBytes2 = fields[6].GetUInt32();
+    uint32 playerBytes2 = character.playerBytes2;
     *p_data << uint8(playerBytes2 & 0xFF);                  // facial hair
 
-    *p_data << uint8(fields[7].GetUInt8());                 // level
-    *p_data << uint32(fields[8].GetUInt32());               // zone
-    *p_data << uint32(fields[9].GetUInt32());               // map
+    *p_data << uint8(character.level);                      // level
+    *p_data << uint32(character.zone);                      // zone
+    *p_data << uint32(character.map);                       // map
 
-    *p_data << fields[10].GetFloat();                       // x
-    *p_data << fields[11].GetFloat();                       // y
-    *p_data << fields[12].GetFloat();                       // z
+    *p_data << character.x;                                 // x
+    *p_data << character.y;                                 // y
+    *p_data << character.z;                                 // z
 
-    *p_data << uint32(fields[13].GetUInt32());              // guild id
+    *p_data << uint32(character.guildId);                   // guild id
 
     uint32 char_flags = 0;
-    uint32 playerFlags = fields[14].GetUInt32();
-    uint32 atLoginFlags = fields[15].GetUInt32();
+    uint32 playerFlags = character.playerFlags;
+    uint32 atLoginFlags = character.atLoginFlags;
     if (playerFlags & PLAYER_FLAGS_HIDE_HELM)
     {
         char_flags |= CHARACTER_FLAG_HIDE_HELM;
@@ -1767,14 +1758,13 @@ bool Player::BuildEnumData(QueryResult* result, WorldPacket* p_data)
         uint32 petFamily  = 0;
 
         // show pet at selection character in character list only for non-ghost character
-        if (result && !(playerFlags & PLAYER_FLAGS_GHOST) && (pClass == CLASS_WARLOCK || pClass == CLASS_HUNTER))
+        if (!(playerFlags & PLAYER_FLAGS_GHOST) && (pClass == CLASS_WARLOCK || pClass == CLASS_HUNTER))
         {
-            uint32 entry = fields[16].GetUInt32();
-            CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(entry);
+            CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(character.petEntry);
             if (cInfo)
             {
-                petDisplayId = fields[17].GetUInt32();
-                petLevel     = fields[18].GetUInt32();
+                petDisplayId = character.petModelId;
+                petLevel     = character.petLevel;
                 petFamily    = cInfo->Family;
             }
         }
@@ -1784,13 +1774,9 @@ bool Player::BuildEnumData(QueryResult* result, WorldPacket* p_data)
         *p_data << uint32(petFamily);
     }
 
-
-    Tokens data = StrSplit(fields[19].GetCppString(), " ");
     for (uint8 slot = 0; slot < EQUIPMENT_SLOT_END; ++slot)
     {
-        uint32 visualbase = slot * 2;                       // entry, perm ench., temp ench.
-        uint32 item_id = GetUInt32ValueFromArray(data, visualbase);
-        const ItemPrototype* proto = ObjectMgr::GetItemPrototype(item_id);
+        const ItemPrototype* proto = ObjectMgr::GetItemPrototype(character.equipment[slot]);
         if (!proto)
         {
             *p_data << uint32(0);
@@ -4714,6 +4700,8 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
             sLog.outError("Player::DeleteFromDB: Unsupported delete method: %u.", charDelete_method);
     }
 
+    sCharacterDirectory.RemoveCharacter(lowguid, charDelete_method == 1);
+
     if (updateRealmChars)
     {
         sWorld.UpdateRealmCharCount(accountId);
@@ -4988,7 +4976,7 @@ void Player::KillPlayer()
     // SetFlag( UNIT_FIELD_FLAGS, UNIT_FLAG_NOT_IN_PVP );
 
     SetUInt32Value(UNIT_DYNAMIC_FLAGS, UNIT_DYNFLAG_NONE);
-    ApplyModByteFlag(PLAYER_FIELD_BYTES, 0, PLAYER_FIELD_BYTE_RELEASE_TIMER, !sMapStore.LookupEntry(GetMapId())->Instanceable());
+    ApplyModByteFlag(PLAYER_FIELD_BYTES, 0, PLAYER_FIELD_BYTE_RELEASE_TIMER, !sMapColumns.Instanceable(GetMapId()));
 
     // 6 minutes until repop at graveyard
     m_deathTimer = 6 * MINUTE * IN_MILLISECONDS;
@@ -7354,17 +7342,13 @@ bool Player::AddHonorCP(float honor, uint8 type, uint32 victim, uint8 victimType
 
 uint32 Player::GetGuildIdFromDB(ObjectGuid guid)
 {
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `guildid` FROM `guild_member` WHERE `guid`='%u'", lowguid);
-    if (!result)
+    CharacterDirectoryEntry character;
+    if (!sCharacterDirectory.GetCharacter(guid.GetCounter(), character))
     {
         return 0;
     }
 
-    uint32 id = result->Fetch()[0].GetUInt32();
-    delete result;
-    return id;
+    return character.guildId;
 }
 
 uint32 Player::GetRankFromDB(ObjectGuid guid)
@@ -7385,35 +7369,23 @@ uint32 Player::GetRankFromDB(ObjectGuid guid)
 uint32 Player::GetZoneIdFromDB(ObjectGuid guid)
 {
     uint32 lowguid = guid.GetCounter();
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `zone` FROM `characters` WHERE `guid`='%u'", lowguid);
-    if (!result)
+
+    CharacterDirectoryEntry character;
+    if (!sCharacterDirectory.GetCharacter(lowguid, character))
     {
         return 0;
     }
-    Field* fields = result->Fetch();
-    uint32 zone = fields[0].GetUInt32();
-    delete result;
 
+    uint32 zone = character.zone;
     if (!zone)
     {
         // stored zone is zero, use generic and slow zone detection
-        result = CharacterDatabase.PQuery("SELECT `map`,`position_x`,`position_y`,`position_z` FROM `characters` WHERE `guid`='%u'", lowguid);
-        if (!result)
-        {
-            return 0;
-        }
-        fields = result->Fetch();
-        uint32 map = fields[0].GetUInt32();
-        float posx = fields[1].GetFloat();
-        float posy = fields[2].GetFloat();
-        float posz = fields[3].GetFloat();
-        delete result;
-
-        zone = sTerrainMgr.GetZoneId(map, posx, posy, posz);
+        zone = sTerrainMgr.GetZoneId(character.map, character.x, character.y, character.z);
 
         if (zone > 0)
         {
             CharacterDatabase.PExecute("UPDATE `characters` SET `zone`='%u' WHERE `guid`='%u'", zone, lowguid);
+            sCharacterDirectory.SetZone(lowguid, zone);
         }
     }
 
@@ -7422,19 +7394,13 @@ uint32 Player::GetZoneIdFromDB(ObjectGuid guid)
 
 uint32 Player::GetLevelFromDB(ObjectGuid guid)
 {
-    uint32 lowguid = guid.GetCounter();
-
-    QueryResult* result = CharacterDatabase.PQuery("SELECT `level` FROM `characters` WHERE `guid`='%u'", lowguid);
-    if (!result)
+    CharacterDirectoryEntry character;
+    if (!sCharacterDirectory.GetCharacter(guid.GetCounter(), character))
     {
         return 0;
     }
 
-    Field* fields = result->Fetch();
-    uint32 level = fields[0].GetUInt32();
-    delete result;
-
-    return level;
+    return character.level;
 }
 
 void Player::UpdateArea(uint32 newArea)
@@ -16444,7 +16410,58 @@ void Player::_LoadIntoDataField(const char* data, uint32 startOffset, uint32 cou
     }
 }
 
-bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
+// takes the rows out of the result, splitting `data` the same way Object::LoadValues does
+static void SplitItemRows(QueryResult* result, ItemLoadDataList& items)
+{
+    if (!result)
+    {
+        return;
+    }
+
+    items.reserve(size_t(result->GetRowCount()));
+    do
+    {
+        Field* fields = result->Fetch();
+
+        items.push_back(ItemLoadData());
+        ItemLoadData& data = items.back();
+        data.text      = fields[1].GetCppString();
+        data.container = fields[2].GetUInt32();
+        data.slot      = fields[3].GetUInt8();
+        data.guidLow   = fields[4].GetUInt32();
+        data.entry     = fields[5].GetUInt32();
+
+        data.values.reserve(CONTAINER_END);
+        for (char const* str = fields[0].GetString(); str && *str;)
+        {
+            if (*str == ' ')
+            {
+                ++str;
+                continue;
+            }
+
+            data.values.push_back(uint32(strtol(str, NULL, 10)));
+            while (*str && *str != ' ')
+            {
+                ++str;
+            }
+        }
+    }
+    while (result->NextRow());
+
+    delete result;
+}
+
+void PlayerLoadQueryHolder::OnResultsReady()
+{
+    SplitItemRows(GetResult(PLAYER_LOGIN_QUERY_LOADINVENTORY), m_inventory);
+    SetResult(PLAYER_LOGIN_QUERY_LOADINVENTORY, NULL);
+
+    SplitItemRows(GetResult(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS), m_mailedItems);
+    SetResult(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS, NULL);
+}
+
+bool Player::LoadFromDB(ObjectGuid guid, PlayerLoadQueryHolder* holder)
 {
     //        0     1        2     3     4      5       6      7   8      9            10            11
     // SELECT guid, account, name, race, class, gender, level, xp, money, playerBytes, playerBytes2, playerFlags,
@@ -16491,6 +16508,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
         delete result;
         CharacterDatabase.PExecute("UPDATE `characters` SET `at_login` = `at_login` | '%u' WHERE `guid` ='%u'",
                                    uint32(AT_LOGIN_RENAME), guid.GetCounter());
+        sCharacterDirectory.SetAtLoginFlags(guid.GetCounter(), uint32(AT_LOGIN_RENAME), 0);
         return false;
     }
 
@@ -16837,7 +16855,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
 
     // Mail
     _LoadMails(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILS));
-    _LoadMailedItems(holder->GetResult(PLAYER_LOGIN_QUERY_LOADMAILEDITEMS));
+    _LoadMailedItems(holder->GetMailedItems());
     UpdateNextMailTimeAndUnreads();
 
     _LoadAuras(holder->GetResult(PLAYER_LOGIN_QUERY_LOADAURAS), time_diff);
@@ -16860,7 +16878,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
     // must be before inventory (some items required reputation check)
     m_reputationMgr.LoadFromDB(holder->GetResult(PLAYER_LOGIN_QUERY_LOADREPUTATION));
 
-    _LoadInventory(holder->GetResult(PLAYER_LOGIN_QUERY_LOADINVENTORY), time_diff);
+    _LoadInventory(holder->GetInventory(), time_diff);
     _LoadItemLoot(holder->GetResult(PLAYER_LOGIN_QUERY_LOADITEMLOOT));
 
     // update items with duration and realtime
@@ -17372,7 +17390,7 @@ void Player::LoadCorpse()
     {
         if (Corpse* corpse = GetCorpse())
         {
-            ApplyModByteFlag(PLAYER_FIELD_BYTES, 0, PLAYER_FIELD_BYTE_RELEASE_TIMER, corpse && !sMapStore.LookupEntry(corpse->GetMapId())->Instanceable());
+            ApplyModByteFlag(PLAYER_FIELD_BYTES, 0, PLAYER_FIELD_BYTE_RELEASE_TIMER, corpse && !sMapColumns.Instanceable(corpse->GetMapId()));
         }
         else
         {
@@ -17382,9 +17400,9 @@ void Player::LoadCorpse()
     }
 }
 
-void Player::_LoadInventory(QueryResult* result, uint32 timediff)
+void Player::_LoadInventory(ItemLoadDataList const& items, uint32 timediff)
 {
-    // QueryResult *result = CharacterDatabase.PQuery("SELECT `data`,`bag`,`slot`,`item`,`item_template` FROM `character_inventory` JOIN `item_instance` ON `character_inventory`.`item` = `item_instance`.`guid` WHERE `character_inventory`.`guid` = '%u' ORDER BY `bag`,`slot`", GetGUIDLow());
+    // rows of "SELECT `data`,`text`,`bag`,`slot`,`item`,`item_template` FROM `character_inventory` JOIN `item_instance` ON `character_inventory`.`item` = `item_instance`.`guid` WHERE `character_inventory`.`guid` = '%u' ORDER BY `bag`,`slot`"
     std::map<uint32, Bag*> bagMap;                          // fast guid lookup for bags
     // NOTE: the "order by `bag`" is important because it makes sure
     // the bagMap is filled before items in the bags are loaded
@@ -17393,19 +17411,18 @@ void Player::_LoadInventory(QueryResult* result, uint32 timediff)
 
     uint32 zone = GetZoneId();
 
-    if (result)
+    if (!items.empty())
     {
         std::list<Item*> problematicItems;
 
         // prevent items from being added to the queue when stored
         m_itemUpdateQueueBlocked = true;
-        do
+        for (ItemLoadDataList::const_iterator data = items.begin(); data != items.end(); ++data)
         {
-            Field* fields = result->Fetch();
-            uint32 bag_guid  = fields[1].GetUInt32();
-            uint8  slot      = fields[2].GetUInt8();
-            uint32 item_lowguid = fields[3].GetUInt32();
-            uint32 item_id   = fields[4].GetUInt32();
+            uint32 bag_guid  = data->container;
+            uint8  slot      = data->slot;
+            uint32 item_lowguid = data->guidLow;
+            uint32 item_id   = data->entry;
 
             ItemPrototype const* proto = ObjectMgr::GetItemPrototype(item_id);
 
@@ -17419,7 +17436,7 @@ void Player::_LoadInventory(QueryResult* result, uint32 timediff)
 
             Item* item = NewItemOrBag(proto);
 
-            if (!item->LoadFromDB(item_lowguid, fields, GetObjectGuid()))
+            if (!item->LoadFromDB(*data, GetObjectGuid()))
             {
                 sLog.outError("Player::_LoadInventory: Player %s has broken item (id: #%u) in inventory, deleted.", GetName(), item_id);
                 CharacterDatabase.PExecute("DELETE FROM `character_inventory` WHERE `item` = '%u'", item_lowguid);
@@ -17542,9 +17559,7 @@ void Player::_LoadInventory(QueryResult* result, uint32 timediff)
                 problematicItems.push_back(item);
             }
         }
-        while (result->NextRow());
 
-        delete result;
         m_itemUpdateQueueBlocked = false;
 
         // send by mail problematic items
@@ -17627,22 +17642,14 @@ void Player::_LoadItemLoot(QueryResult* result)
 }
 
 // load mailed item which should receive current player
-void Player::_LoadMailedItems(QueryResult* result)
+void Player::_LoadMailedItems(ItemLoadDataList const& items)
 {
-    // data needs to be at first place for Item::LoadFromDB
-    //         0     1     2        3          4
-    // "SELECT data, text, mail_id, item_guid, item_template FROM mail_items JOIN item_instance ON item_guid = guid WHERE receiver = '%u'", GUID_LOPART(m_guid)
-    if (!result)
+    // rows of "SELECT data, text, mail_id, 0, item_guid, item_template FROM mail_items JOIN item_instance ON item_guid = guid WHERE receiver = '%u'", GUID_LOPART(m_guid)
+    for (ItemLoadDataList::const_iterator data = items.begin(); data != items.end(); ++data)
     {
-        return;
-    }
-
-    do
-    {
-        Field* fields = result->Fetch();
-        uint32 mail_id       = fields[1].GetUInt32();
-        uint32 item_guid_low = fields[2].GetUInt32();
-        uint32 item_template = fields[3].GetUInt32();
+        uint32 mail_id       = data->container;
+        uint32 item_guid_low = data->guidLow;
+        uint32 item_template = data->entry;
 
         Mail* mail = GetMail(mail_id);
         if (!mail)
@@ -17663,7 +17670,7 @@ void Player::_LoadMailedItems(QueryResult* result)
 
         Item* item = NewItemOrBag(proto);
 
-        if (!item->LoadFromDB(item_guid_low, fields, GetObjectGuid()))
+        if (!item->LoadFromDB(*data, GetObjectGuid()))
         {
             sLog.outError("Player::_LoadMailedItems - Item in mail (%u) doesn't exist !!!! - item guid: %u, deleted from mail", mail->messageID, item_guid_low);
             CharacterDatabase.PExecute("DELETE FROM `mail_items` WHERE `item_guid` = '%u'", item_guid_low);
@@ -17674,9 +17681,6 @@ void Player::_LoadMailedItems(QueryResult* result)
 
         AddMItem(item);
     }
-    while (result->NextRow());
-
-    delete result;
 }
 
 void Player::_LoadMails(QueryResult* result)
@@ -18436,6 +18440,8 @@ void Player::SaveToDB()
 
     CharacterDatabase.CommitTransaction();
 
+    sCharacterDirectory.UpdateFromPlayer(this);
+
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
@@ -18599,6 +18605,9 @@ void Player::_SaveAuras()
 
 void Player::_SaveInventory()
 {
+    // all `item_instance` and `character_inventory` rows go out as a few multi-row statements at the end
+    ItemSaveBatch batch;
+
     // force items in buyback slots to new state
     // and remove those that aren't already
     for (uint8 i = BUYBACK_SLOT_START; i < BUYBACK_SLOT_END; ++i)
@@ -18609,14 +18618,8 @@ void Player::_SaveInventory()
             continue;
         }
 
-        static SqlStatementID delInv ;
-        static SqlStatementID delItemInst ;
-
-        SqlStatement stmt = CharacterDatabase.CreateStatement(delInv, "DELETE FROM `character_inventory` WHERE `item` = ?");
-        stmt.PExecute(item->GetGUIDLow());
-
-        stmt = CharacterDatabase.CreateStatement(delItemInst, "DELETE FROM `item_instance` WHERE `guid` = ?");
-        stmt.PExecute(item->GetGUIDLow());
+        batch.DeleteInventory(item->GetGUIDLow());
+        batch.DeleteItem(item->GetGUIDLow());
 
         m_items[i]->FSetState(ITEM_NEW);
     }
@@ -18630,6 +18633,7 @@ void Player::_SaveInventory()
     // if no changes
     if (m_itemUpdateQueue.empty())
     {
+        batch.Flush();
         return;
     }
 
@@ -18660,12 +18664,11 @@ void Player::_SaveInventory()
     {
         sLog.outError("Player::_SaveInventory - one or more errors occurred save aborted!");
         ChatHandler(this).SendSysMessage(LANG_ITEM_SAVE_FAILED);
+        batch.Flush();
         return;
     }
 
-    static SqlStatementID insertInventory ;
     static SqlStatementID updateInventory ;
-    static SqlStatementID deleteInventory ;
 
     for (size_t i = 0; i < m_itemUpdateQueue.size(); ++i)
     {
@@ -18681,16 +18684,8 @@ void Player::_SaveInventory()
         switch (item->GetState())
         {
             case ITEM_NEW:
-            {
-                SqlStatement stmt = CharacterDatabase.CreateStatement(insertInventory, "INSERT INTO `character_inventory` (`guid`,`bag`,`slot`,`item`,`item_template`) VALUES (?, ?, ?, ?, ?)");
-                stmt.addUInt32(GetGUIDLow());
-                stmt.addUInt32(bag_guid);
-                stmt.addUInt8(item->GetSlot());
-                stmt.addUInt32(item->GetGUIDLow());
-                stmt.addUInt32(item->GetEntry());
-                stmt.Execute();
-            }
-            break;
+                batch.AddInventory(GetGUIDLow(), bag_guid, item->GetSlot(), item->GetGUIDLow(), item->GetEntry());
+                break;
             case ITEM_CHANGED:
             {
                 SqlStatement stmt = CharacterDatabase.CreateStatement(updateInventory, "UPDATE `character_inventory` SET `guid` = ?, `bag` = ?, `slot` = ?, `item_template` = ? WHERE `item` = ?");
@@ -18703,18 +18698,17 @@ void Player::_SaveInventory()
             }
             break;
             case ITEM_REMOVED:
-            {
-                SqlStatement stmt = CharacterDatabase.CreateStatement(deleteInventory, "DELETE FROM `character_inventory` WHERE `item` = ?");
-                stmt.PExecute(item->GetGUIDLow());
-            }
-            break;
+                batch.DeleteInventory(item->GetGUIDLow());
+                break;
             case ITEM_UNCHANGED:
                 break;
         }
 
-        item->SaveToDB();                                   // item have unchanged inventory record and can be save standalone
+        item->SaveToDB(&batch);
     }
     m_itemUpdateQueue.clear();
+
+    batch.Flush();
 }
 
 void Player::_SaveHonorCP()
@@ -19109,6 +19103,8 @@ void Player::SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, f
        << "`transguid`='0',`taxi_path`='' WHERE `guid`='" << guid.GetCounter() << "'";
     DEBUG_LOG("%s", ss.str().c_str());
     CharacterDatabase.Execute(ss.str().c_str());
+
+    sCharacterDirectory.SetPosition(guid.GetCounter(), mapid, zone, x, y, z);
 }
 
 void Player::SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value)
@@ -23158,6 +23154,7 @@ void Player::RemoveAtLoginFlag(AtLoginFlags f, bool in_db_also /*= false*/)
     if (in_db_also)
     {
         CharacterDatabase.PExecute("UPDATE `characters` set `at_login` = `at_login` & ~ %u WHERE `guid` ='%u'", uint32(f), GetGUIDLow());
+        sCharacterDirectory.SetAtLoginFlags(GetGUIDLow(), 0, uint32(f));
     }
 }
 
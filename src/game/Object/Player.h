@@ -61,6 +61,7 @@ class Spell;
 class Item;
 
 struct AreaTrigger;
+struct CharacterDirectoryEntry;
 
 #ifdef ENABLE_PLAYERBOTS
 class PlayerbotAI;
@@ -723,6 +724,26 @@ enum PlayerLoginQueryIndex
     MAX_PLAYER_LOGIN_QUERY
 };
 
+/**
+ * @brief Base of the query holders used to load a player.
+ *
+ * The inventory and mailed item rows (`data`,`text`,container,`slot`,guid,entry) are
+ * taken out of their results and split on the database thread, so Player::LoadFromDB
+ * only has to create the items from the prepared values.
+ */
+class PlayerLoadQueryHolder : public SqlQueryHolder
+{
+    public:
+        void OnResultsReady() override;
+
+        ItemLoadDataList const& GetInventory() const { return m_inventory; }
+        ItemLoadDataList const& GetMailedItems() const { return m_mailedItems; }
+
+    private:
+        ItemLoadDataList m_inventory;
+        ItemLoadDataList m_mailedItems;
+};
+
 // Delayed operations for players
 enum PlayerDelayedOperations
 {
@@ -1057,7 +1078,7 @@ class Player : public Unit
 
         void Update(uint32 update_diff, uint32 time) override; // Update the player
 
-        static bool BuildEnumData(QueryResult* result,  WorldPacket* p_data); // Build enumeration data
+        static bool BuildEnumData(CharacterDirectoryEntry const& character, WorldPacket* p_data); // Build enumeration data
 
         void SetInWater(bool apply); // Set the player in water
 
@@ -1921,7 +1942,7 @@ class Player : public Unit
         /*********************************************************/
 
         // Load the player from the database
-        bool LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder);
+        bool LoadFromDB(ObjectGuid guid, PlayerLoadQueryHolder* holder);
 #ifdef ENABLE_PLAYERBOTS
         // Minimal load of the player from the database
         bool MinimalLoadFromDB(QueryResult *result, uint32 guid);
@@ -3400,6 +3421,9 @@ class Player : public Unit
         // Check if the player has a specific at-login flag
         bool HasAtLoginFlag(AtLoginFlags f) const { return m_atLoginFlags & f; }
 
+        // Get all at-login flags of the player
+        uint32 GetAtLoginFlags() const { return m_atLoginFlags; }
+
         // Set an at-login flag for the player
         void SetAtLoginFlag(AtLoginFlags f) { m_atLoginFlags |= f; }
 
@@ -3591,7 +3615,7 @@ class Player : public Unit
         // Load bound instances from the database
         void _LoadBoundInstances(QueryResult* result);
         void _LoadHonorCP(QueryResult* result);
-        void _LoadInventory(QueryResult* result, uint32 timediff);
+        void _LoadInventory(ItemLoadDataList const& items, uint32 timediff);
 
         // Load item loot from the database
         void _LoadItemLoot(QueryResult* result);
@@ -3600,7 +3624,7 @@ class Player : public Unit
         void _LoadMails(QueryResult* result);
 
         // Load mailed items from the database
-        void _LoadMailedItems(QueryResult* result);
+        void _LoadMailedItems(ItemLoadDataList const& items);
 
         // Load quest status from the database
         void _LoadQuestStatus(QueryResult* result);
@@ -413,12 +413,7 @@ WeaponAttackType GetWeaponAttackType(SpellEntry const* spellInfo)
 
 bool IsPassiveSpell(uint32 spellId)
 {
-    SpellEntry const* spellInfo = sSpellStore.LookupEntry(spellId);
-    if (!spellInfo)
-    {
-        return false;
-    }
-    return IsPassiveSpell(spellInfo);
+    return sSpellColumns.HasAttribute(spellId, SPELL_ATTR_PASSIVE);
 }
 
 bool IsPassiveSpell(SpellEntry const* spellInfo)
@@ -428,13 +423,11 @@ bool IsPassiveSpell(SpellEntry const* spellInfo)
 
 bool IsNoStackAuraDueToAura(uint32 spellId_1, uint32 spellId_2)
 {
-    SpellEntry const* spellInfo_1 = sSpellStore.LookupEntry(spellId_1);
-    SpellEntry const* spellInfo_2 = sSpellStore.LookupEntry(spellId_2);
-    if (!spellInfo_1 || !spellInfo_2)
+    if (!sSpellColumns.HasSpell(spellId_1) || !sSpellColumns.HasSpell(spellId_2))
     {
         return false;
     }
-    if (spellInfo_1->Id == spellId_2)
+    if (spellId_1 == spellId_2)
     {
         return false;
     }
@@ -450,10 +443,19 @@ bool IsNoStackAuraDueToAura(uint32 spellId_1, uint32 spellId_2)
     {
         for (int32 j = 0; j < MAX_EFFECT_INDEX; ++j)
         {
-            if (spellInfo_1->Effect[i] == spellInfo_2->Effect[j]
-                && spellInfo_1->EffectApplyAuraName[i] == spellInfo_2->EffectApplyAuraName[j]
-                && spellInfo_1->EffectMiscValue[i] == spellInfo_2->EffectMiscValue[j]
-                && spellInfo_1->EffectItemType[i] == spellInfo_2->EffectItemType[j]
+            SpellEffectIndex effIndex_1 = SpellEffectIndex(i);
+            SpellEffectIndex effIndex_2 = SpellEffectIndex(j);
+            if (sSpellColumns.GetEffect(spellId_1, effIndex_1) != sSpellColumns.GetEffect(spellId_2, effIndex_2)
+                || sSpellColumns.GetEffectAura(spellId_1, effIndex_1) != sSpellColumns.GetEffectAura(spellId_2, effIndex_2)
+                || sSpellColumns.GetEffectMiscValue(spellId_1, effIndex_1) != sSpellColumns.GetEffectMiscValue(spellId_2, effIndex_2))
+            {
+                continue;
+            }
+
+            // item type is not in the columns, only pairs that match so far need the records
+            SpellEntry const* spellInfo_1 = sSpellStore.LookupEntry(spellId_1);
+            SpellEntry const* spellInfo_2 = sSpellStore.LookupEntry(spellId_2);
+            if (spellInfo_1->EffectItemType[i] == spellInfo_2->EffectItemType[j]
                 && (spellInfo_1->Effect[i] != 0 || spellInfo_1->EffectApplyAuraName[i] != 0 ||
                     spellInfo_1->EffectMiscValue[i] != 0 || spellInfo_1->EffectItemType[i] != 0))
                     {
@@ -1057,17 +1059,22 @@ bool IsPositiveEffect(SpellEntry const* spellproto, SpellEffectIndex effIndex)
 
 bool IsPositiveSpell(uint32 spellId)
 {
-    SpellEntry const* spellproto = sSpellStore.LookupEntry(spellId);
-    if (!spellproto)
-    {
-        return false;
-    }
+    return sSpellColumns.IsPositiveSpell(spellId);
+}
 
-    return IsPositiveSpell(spellproto);
+bool IsPositiveEffect(uint32 spellId, SpellEffectIndex effIndex)
+{
+    return sSpellColumns.IsPositiveEffect(spellId, effIndex);
 }
 
 bool IsPositiveSpell(SpellEntry const* spellproto)
 {
+    // precomputed for every Spell.dbc record
+    if (sSpellColumns.HasSpell(spellproto->Id))
+    {
+        return sSpellColumns.IsPositiveSpell(spellproto->Id);
+    }
+
     // spells with at least one negative effect are considered negative
     // some self-applied spells have negative effects but in self casting case negative check ignored.
     for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
@@ -2213,6 +2220,8 @@ void SpellMgr::ModDBCSpellAttributes()
                 spellInfo->procFlags = PROC_FLAG_NONE;
                 break;
         }
+
+        sSpellColumns.Refresh(spellInfo);
     }
 }
 
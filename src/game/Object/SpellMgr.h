@@ -124,14 +124,7 @@ inline bool IsAuraApplyEffect(SpellEntry const* spellInfo, SpellEffectIndex effe
 
 inline bool IsSpellAppliesAura(SpellEntry const* spellInfo, uint32 effectMask = ((1 << EFFECT_INDEX_0) | (1 << EFFECT_INDEX_1) | (1 << EFFECT_INDEX_2)))
 {
-    for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
-        if (effectMask & (1 << i))
-            if (IsAuraApplyEffect(spellInfo, SpellEffectIndex(i)))
-            {
-                return true;
-            }
-
-    return false;
+    return (sSpellColumns.GetAuraEffectMask(spellInfo->Id) & effectMask) != 0;
 }
 
 inline bool IsEffectHandledOnDelayedSpellLaunch(SpellEntry const* spellInfo, SpellEffectIndex effecIdx)
@@ -236,6 +229,7 @@ inline bool IsNonCombatSpell(SpellEntry const* spellInfo)
 bool IsPositiveSpell(uint32 spellId);
 bool IsPositiveSpell(SpellEntry const* spellproto);
 bool IsPositiveEffect(SpellEntry const* spellInfo, SpellEffectIndex effIndex);
+bool IsPositiveEffect(uint32 spellId, SpellEffectIndex effIndex);
 bool IsPositiveTarget(uint32 targetA, uint32 targetB);
 
 bool IsExplicitPositiveTarget(uint32 targetA);
@@ -694,18 +688,7 @@ inline uint32 GetDispellMask(DispelType dispel)
 
 inline bool IsAuraAddedBySpell(uint32 auraType, uint32 spellId)
 {
-    SpellEntry const* spellproto = sSpellStore.LookupEntry(spellId);
-    if (!spellproto)
-    {
-        return false;
-    }
-
-    for (int i = 0; i < 3; i++)
-        if (spellproto->EffectApplyAuraName[i] == auraType)
-        {
-            return true;
-        }
-    return false;
+    return sSpellColumns.HasAura(spellId, AuraType(auraType));
 }
 
 // Diminishing Returns interaction with spells
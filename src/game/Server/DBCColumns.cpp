@@ -0,0 +1,180 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "DBCColumns.h"
+#include "SpellMgr.h"
+
+#include <set>
+
+void SpellColumns::Load(DBCStorage<SpellEntry> const& store)
+{
+    m_store = &store;
+    m_count = store.GetNumRows();
+
+    m_flags.assign(m_count, 0);
+    m_attributes.assign(m_count, 0);
+    m_attributesEx.assign(m_count, 0);
+    m_attributesEx2.assign(m_count, 0);
+    m_attributesEx3.assign(m_count, 0);
+    m_attributesEx4.assign(m_count, 0);
+    m_effect.assign(m_count * MAX_EFFECT_INDEX, 0);
+    m_effectAura.assign(m_count * MAX_EFFECT_INDEX, 0);
+    m_effectMiscValue.assign(m_count * MAX_EFFECT_INDEX, 0);
+
+    for (uint32 i = 1; i < m_count; ++i)
+    {
+        if (SpellEntry const* spellInfo = store.LookupEntry(i))
+        {
+            Store(spellInfo);
+        }
+    }
+}
+
+void SpellColumns::Refresh(SpellEntry const* spellInfo)
+{
+    if (spellInfo->Id >= m_count)
+    {
+        return;
+    }
+
+    Store(spellInfo);
+
+    // IsPositiveEffect() of a periodic trigger aura looks at the triggered spell,
+    // so spells triggering a patched one are classified again, and so on up the chain
+    std::set<uint32> refreshed;
+    std::vector<uint32> pending(1, spellInfo->Id);
+    refreshed.insert(spellInfo->Id);
+
+    while (!pending.empty())
+    {
+        uint32 triggeredId = pending.back();
+        pending.pop_back();
+
+        for (uint32 id = 1; id < m_count; ++id)
+        {
+            if (!(m_flags[id] & SPELL_COLUMN_EXISTS) || refreshed.find(id) != refreshed.end())
+            {
+                continue;
+            }
+
+            for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+            {
+                if (m_effectAura[id * MAX_EFFECT_INDEX + i] != SPELL_AURA_PERIODIC_TRIGGER_SPELL)
+                {
+                    continue;
+                }
+
+                SpellEntry const* triggering = m_store->LookupEntry(id);
+                if (triggering->EffectTriggerSpell[i] == triggeredId)
+                {
+                    Store(triggering);
+                    refreshed.insert(id);
+                    pending.push_back(id);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void SpellColumns::Store(SpellEntry const* spellInfo)
+{
+    uint32 id = spellInfo->Id;
+
+    m_attributes[id] = spellInfo->Attributes;
+    m_attributesEx[id] = spellInfo->AttributesEx;
+    m_attributesEx2[id] = spellInfo->AttributesEx2;
+    m_attributesEx3[id] = spellInfo->AttributesEx3;
+    m_attributesEx4[id] = spellInfo->AttributesEx4;
+
+    uint8 flags = SPELL_COLUMN_EXISTS | SPELL_COLUMN_POSITIVE;
+    for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+    {
+        SpellEffectIndex effIndex = SpellEffectIndex(i);
+
+        m_effect[id * MAX_EFFECT_INDEX + i] = uint16(spellInfo->Effect[i]);
+        m_effectAura[id * MAX_EFFECT_INDEX + i] = uint16(spellInfo->EffectApplyAuraName[i]);
+        m_effectMiscValue[id * MAX_EFFECT_INDEX + i] = spellInfo->EffectMiscValue[i];
+
+        // positive check done the same way as IsPositiveSpell(SpellEntry const*)
+        if (::IsPositiveEffect(spellInfo, effIndex))
+        {
+            flags |= SPELL_COLUMN_POSITIVE_EFFECT_0 << i;
+        }
+        else if (spellInfo->Effect[i])
+        {
+            flags &= ~SPELL_COLUMN_POSITIVE;
+        }
+
+        if (IsAuraApplyEffect(spellInfo, effIndex))
+        {
+            flags |= 1 << (SPELL_COLUMN_AURA_EFFECT_SHIFT + i);
+        }
+    }
+
+    m_flags[id] = flags;
+}
+
+bool SpellColumns::HasEffect(uint32 spellId, SpellEffects effect) const
+{
+    if (!HasSpell(spellId))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+        if (m_effect[spellId * MAX_EFFECT_INDEX + i] == effect)
+        {
+            return true;
+        }
+    return false;
+}
+
+bool SpellColumns::HasAura(uint32 spellId, AuraType aura) const
+{
+    if (!HasSpell(spellId))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
+        if (m_effectAura[spellId * MAX_EFFECT_INDEX + i] == aura)
+        {
+            return true;
+        }
+    return false;
+}
+
+void MapColumns::Load(DBCStorage<MapEntry> const& store)
+{
+    m_mapType.assign(store.GetNumRows(), uint8(MAP_COMMON));
+
+    for (uint32 i = 0; i < store.GetNumRows(); ++i)
+    {
+        if (MapEntry const* mapEntry = store.LookupEntry(i))
+        {
+            m_mapType[i] = uint8(mapEntry->map_type);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_DBCCOLUMNS_H
+#define MANGOS_DBCCOLUMNS_H
+
+#include "Common.h"
+#include "DataStores/DBCStore.h"
+#include "DBCStructure.h"
+#include "SpellAuraDefines.h"
+
+#include <vector>
+
+/**
+ * @brief Column copy of the Spell.dbc fields read by the spell and aura checks.
+ *
+ * A SpellEntry is about 700 bytes, so checks that only look at the attributes
+ * or the effect types of a spell pull in a whole record for a few words. Here
+ * each field lives in its own array indexed by spell id (the effect fields
+ * keep the 3 values of a spell next to each other), and the positive/negative
+ * classification, which walks most of the record, is computed once per spell.
+ *
+ * Built right after Spell.dbc is loaded. Code that patches a record in place
+ * must call Refresh() for it; the spells whose positivity depends on it are
+ * classified again as well.
+ */
+class SpellColumns
+{
+    public:
+        SpellColumns() : m_store(NULL), m_count(0) {}
+
+        void Load(DBCStorage<SpellEntry> const& store);
+        void Refresh(SpellEntry const* spellInfo);
+
+        bool HasSpell(uint32 spellId) const { return spellId < m_count && (m_flags[spellId] & SPELL_COLUMN_EXISTS); }
+
+        bool HasAttribute(uint32 spellId, SpellAttributes attribute) const { return HasSpell(spellId) && (m_attributes[spellId] & attribute); }
+        bool HasAttribute(uint32 spellId, SpellAttributesEx attribute) const { return HasSpell(spellId) && (m_attributesEx[spellId] & attribute); }
+        bool HasAttribute(uint32 spellId, SpellAttributesEx2 attribute) const { return HasSpell(spellId) && (m_attributesEx2[spellId] & attribute); }
+        bool HasAttribute(uint32 spellId, SpellAttributesEx3 attribute) const { return HasSpell(spellId) && (m_attributesEx3[spellId] & attribute); }
+        bool HasAttribute(uint32 spellId, SpellAttributesEx4 attribute) const { return HasSpell(spellId) && (m_attributesEx4[spellId] & attribute); }
+
+        // effect accessors expect HasSpell(spellId)
+        uint32 GetEffect(uint32 spellId, SpellEffectIndex effIndex) const { return m_effect[spellId * MAX_EFFECT_INDEX + effIndex]; }
+        uint32 GetEffectAura(uint32 spellId, SpellEffectIndex effIndex) const { return m_effectAura[spellId * MAX_EFFECT_INDEX + effIndex]; }
+        int32 GetEffectMiscValue(uint32 spellId, SpellEffectIndex effIndex) const { return m_effectMiscValue[spellId * MAX_EFFECT_INDEX + effIndex]; }
+
+        bool HasEffect(uint32 spellId, SpellEffects effect) const;
+        bool HasAura(uint32 spellId, AuraType aura) const;
+
+        /// Mask of the effect indexes that apply an aura, 0 for unknown spells.
+        uint32 GetAuraEffectMask(uint32 spellId) const { return HasSpell(spellId) ? (m_flags[spellId] >> SPELL_COLUMN_AURA_EFFECT_SHIFT) & 0x07 : 0; }
+
+        /// Same as IsPositiveEffect() on the record, false for unknown spells.
+        bool IsPositiveEffect(uint32 spellId, SpellEffectIndex effIndex) const { return HasSpell(spellId) && (m_flags[spellId] & (SPELL_COLUMN_POSITIVE_EFFECT_0 << effIndex)); }
+        /// Same as IsPositiveSpell() on the record, false for unknown spells.
+        bool IsPositiveSpell(uint32 spellId) const { return HasSpell(spellId) && (m_flags[spellId] & SPELL_COLUMN_POSITIVE); }
+
+    private:
+        enum SpellColumnFlags
+        {
+            SPELL_COLUMN_EXISTS             = 0x01,
+            SPELL_COLUMN_POSITIVE           = 0x02,
+            SPELL_COLUMN_POSITIVE_EFFECT_0  = 0x04,                 // 0x04, 0x08, 0x10 for effect 0-2
+            SPELL_COLUMN_AURA_EFFECT_SHIFT  = 5                     // 0x20, 0x40, 0x80 for effect 0-2
+        };
+
+        void Store(SpellEntry const* spellInfo);
+
+        DBCStorage<SpellEntry> const* m_store;
+        uint32 m_count;
+        std::vector<uint8> m_flags;
+        std::vector<uint32> m_attributes;
+        std::vector<uint32> m_attributesEx;
+        std::vector<uint32> m_attributesEx2;
+        std::vector<uint32> m_attributesEx3;
+        std::vector<uint32> m_attributesEx4;
+        std::vector<uint16> m_effect;                               // MAX_EFFECT_INDEX per spell
+        std::vector<uint16> m_effectAura;                           // MAX_EFFECT_INDEX per spell
+        std::vector<int32> m_effectMiscValue;                       // MAX_EFFECT_INDEX per spell
+};
+
+/**
+ * @brief Map.dbc instance types packed into one byte per map id.
+ */
+class MapColumns
+{
+    public:
+        void Load(DBCStorage<MapEntry> const& store);
+
+        /// MAP_COMMON for unknown maps.
+        uint32 GetMapType(uint32 mapId) const { return mapId < m_mapType.size() ? m_mapType[mapId] : uint32(MAP_COMMON); }
+
+        bool IsDungeon(uint32 mapId) const { uint32 type = GetMapType(mapId); return type == MAP_INSTANCE || type == MAP_RAID; }
+        bool Instanceable(uint32 mapId) const { uint32 type = GetMapType(mapId); return type == MAP_INSTANCE || type == MAP_RAID || type == MAP_BATTLEGROUND; }
+        bool IsBattleGround(uint32 mapId) const { return GetMapType(mapId) == MAP_BATTLEGROUND; }
+        /// Same as MapEntry::IsMountAllowed().
+        bool IsMountAllowed(uint32 mapId) const
+        {
+            return !IsDungeon(mapId) ||
+                   mapId == 309 || mapId == 209 || mapId == 509 || mapId == 269;
+        }
+
+    private:
+        std::vector<uint8> m_mapType;
+};
+
+#endif
@@ -97,6 +97,7 @@ DBCStorage <LockEntry> sLockStore(LockEntryfmt);
 DBCStorage <MailTemplateEntry> sMailTemplateStore(MailTemplateEntryfmt);
 
 DBCStorage <MapEntry> sMapStore(MapEntryfmt);
+MapColumns sMapColumns;
 
 #if !defined(CLASSIC)
 DBCStorage <MovieEntry> sMovieStore(MovieEntryfmt);
@@ -111,6 +112,7 @@ DBCStorage <SoundEntriesEntry> sSoundEntriesStore(SoundEntriesfmt);
 
 DBCStorage <SpellItemEnchantmentEntry> sSpellItemEnchantmentStore(SpellItemEnchantmentfmt);
 DBCStorage <SpellEntry> sSpellStore(SpellEntryfmt);
+SpellColumns sSpellColumns;
 DBCStorage <SpellFocusObjectEntry> sSpellFocusObjectStore(SpellFocusObjectfmt);
 SpellCategoryStore sSpellCategoryStore;
 PetFamilySpellsStore sPetFamilySpellsStore;
@@ -292,6 +294,7 @@ void LoadDBCStores(const std::string& dataPath)
     LoadDBC(availableDbcLocales, bar, bad_dbc_files, sLockStore,                dbcPath, "Lock.dbc");
     LoadDBC(availableDbcLocales, bar, bad_dbc_files, sMailTemplateStore,        dbcPath, "MailTemplate.dbc");
     LoadDBC(availableDbcLocales, bar, bad_dbc_files, sMapStore,                 dbcPath, "Map.dbc");
+    sMapColumns.Load(sMapStore);
 #if !defined(CLASSIC)
     LoadDBC(availableDbcLocales, bar, bad_dbc_files, sMovieStore,               dbcPath, "Movie.dbc");
 #endif
@@ -316,6 +319,9 @@ void LoadDBCStores(const std::string& dataPath)
 #endif
     }
 
+    // copy of the fields read by the spell and aura checks, see SpellColumns
+    sSpellColumns.Load(sSpellStore);
+
     for (uint32 j = 0; j < sSkillLineAbilityStore.GetNumRows(); ++j)
     {
         SkillLineAbilityEntry const* skillLine = sSkillLineAbilityStore.LookupEntry(j);
@@ -28,6 +28,7 @@
 #include "Common.h"
 #include "DataStores/DBCStore.h"
 #include "DBCStructure.h"
+#include "DBCColumns.h"
 
 #include <list>
 
@@ -97,6 +98,7 @@ extern DBCStorage <LiquidTypeEntry>              sLiquidTypeStore;
 extern DBCStorage <LockEntry>                    sLockStore;
 extern DBCStorage <MailTemplateEntry>            sMailTemplateStore;
 extern DBCStorage <MapEntry>                     sMapStore;
+extern MapColumns                                sMapColumns;
 #if !defined(CLASSIC)
 extern DBCStorage <MovieEntry>                   sMovieStore;
 #endif
@@ -115,6 +117,7 @@ extern DBCStorage <SpellRadiusEntry>             sSpellRadiusStore;
 extern DBCStorage <SpellRangeEntry>              sSpellRangeStore;
 extern DBCStorage <SpellShapeshiftFormEntry>     sSpellShapeshiftFormStore;
 extern DBCStorage <SpellEntry>                   sSpellStore;
+extern SpellColumns                              sSpellColumns;
 extern DBCStorage <StableSlotPricesEntry>        sStableSlotPricesStore;
 extern DBCStorage <TalentEntry>                  sTalentStore;
 extern DBCStorage <TalentTabEntry>               sTalentTabStore;
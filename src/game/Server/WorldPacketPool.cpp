@@ -0,0 +1,131 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "WorldPacketPool.h"
+#include "WorldPacket.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#define PACKET_POOL_BATCH           32      // packets moved between a thread cache and the shared list at once
+#define PACKET_POOL_SHARED_MAX      8192    // packets beyond this are freed instead of pooled
+#define PACKET_POOL_MAX_SIZE        4096    // bigger packets are freed so rare large buffers are not kept around
+
+namespace
+{
+    struct SharedPacketList
+    {
+        std::mutex lock;
+        std::vector<WorldPacket*> packets;
+    };
+
+    // never destroyed, thread caches may flush into it during exit
+    SharedPacketList& GetSharedList()
+    {
+        static SharedPacketList* list = new SharedPacketList();
+        return *list;
+    }
+
+    struct ThreadPacketCache
+    {
+        std::vector<WorldPacket*> packets;
+
+        ~ThreadPacketCache()
+        {
+            Flush(packets.size());
+        }
+
+        void Refill()
+        {
+            SharedPacketList& shared = GetSharedList();
+            std::lock_guard<std::mutex> guard(shared.lock);
+
+            size_t count = std::min<size_t>(PACKET_POOL_BATCH, shared.packets.size());
+            packets.insert(packets.end(), shared.packets.end() - count, shared.packets.end());
+            shared.packets.resize(shared.packets.size() - count);
+        }
+
+        void Flush(size_t count)
+        {
+            SharedPacketList& shared = GetSharedList();
+            std::lock_guard<std::mutex> guard(shared.lock);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                WorldPacket* packet = packets.back();
+                packets.pop_back();
+
+                if (shared.packets.size() < PACKET_POOL_SHARED_MAX)
+                {
+                    shared.packets.push_back(packet);
+                }
+                else
+                {
+                    delete packet;
+                }
+            }
+        }
+    };
+
+    thread_local ThreadPacketCache threadCache;
+}
+
+WorldPacket* WorldPacketPool::Acquire(uint16 opcode, size_t reserve)
+{
+    if (threadCache.packets.empty())
+    {
+        threadCache.Refill();
+    }
+
+    if (threadCache.packets.empty())
+    {
+        return new WorldPacket(opcode, reserve);
+    }
+
+    WorldPacket* packet = threadCache.packets.back();
+    threadCache.packets.pop_back();
+    packet->Initialize(opcode, reserve);
+    return packet;
+}
+
+void WorldPacketPool::Release(WorldPacket* packet)
+{
+    if (!packet)
+    {
+        return;
+    }
+
+    if (packet->size() > PACKET_POOL_MAX_SIZE)
+    {
+        delete packet;
+        return;
+    }
+
+    threadCache.packets.push_back(packet);
+    if (threadCache.packets.size() >= 2 * PACKET_POOL_BATCH)
+    {
+        threadCache.Flush(PACKET_POOL_BATCH);
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_H_WORLDPACKETPOOL
+#define MANGOS_H_WORLDPACKETPOOL
+
+#include "Common.h"
+
+class WorldPacket;
+
+/**
+ * @brief Recycles the heap WorldPackets that carry client packets into the sessions.
+ *
+ * Network threads acquire, world and map threads release. Every thread keeps a
+ * small cache and only touches the shared free list to move packets in batches,
+ * so a packet round trip normally takes no lock and no heap allocation.
+ */
+class WorldPacketPool
+{
+    public:
+        /// Returns an empty packet with @p reserve bytes of storage reserved.
+        static WorldPacket* Acquire(uint16 opcode, size_t reserve);
+        /// Takes back a packet previously created with new or Acquire(). NULL is ignored.
+        static void Release(WorldPacket* packet);
+};
+
+/**
+ * @brief Owns a pooled packet for one scope, like ACE_Auto_Ptr but releasing to the pool.
+ */
+class PooledPacketPtr
+{
+    public:
+        explicit PooledPacketPtr(WorldPacket* packet) : m_packet(packet) {}
+        ~PooledPacketPtr() { WorldPacketPool::Release(m_packet); }
+
+        WorldPacket* release()
+        {
+            WorldPacket* packet = m_packet;
+            m_packet = NULL;
+            return packet;
+        }
+
+    private:
+        PooledPacketPtr(PooledPacketPtr const&) = delete;
+        PooledPacketPtr& operator=(PooledPacketPtr const&) = delete;
+
+        WorldPacket* m_packet;
+};
+
+#endif
@@ -32,6 +32,7 @@
 #include "Log.h"
 #include "Opcodes.h"
 #include "WorldPacket.h"
+#include "WorldPacketPool.h"
 #include "WorldSession.h"
 #include "Player.h"
 #include "ObjectMgr.h"
@@ -42,6 +43,7 @@
 #include "ObjectAccessor.h"
 #include "BattleGround/BattleGroundMgr.h"
 #include "SocialMgr.h"
+#include "TickProfiler.h"
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
 #endif /* ENABLE_ELUNA */
@@ -143,7 +145,7 @@ WorldSession::~WorldSession()
     WorldPacket* packet = NULL;
     while (_recvQueue.next(packet))
     {
-        delete packet;
+        WorldPacketPool::Release(packet);
     }
 }
 
@@ -234,6 +236,13 @@ void WorldSession::QueuePacket(WorldPacket* new_packet)
     _recvQueue.add(new_packet);
 }
 
+/// Add a batch of incoming packets to the queue, taking the queue lock once
+void WorldSession::QueuePackets(std::vector<WorldPacket*>& packets)
+{
+    _recvQueue.add(packets.begin(), packets.end());
+    packets.clear();
+}
+
 /// Logging helper for unexpected opcodes
 void WorldSession::LogUnexpectedOpcode(WorldPacket* packet, const char* reason)
 {
@@ -369,7 +378,7 @@ bool WorldSession::Update(PacketFilter& updater)
             }
         }
 
-        delete packet;
+        WorldPacketPool::Release(packet);
     }
 
 #ifdef ENABLE_PLAYERBOTS
@@ -426,7 +435,7 @@ void WorldSession::HandleBotPackets()
     {
         OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
         (this->*opHandle.handler)(*packet);
-        delete packet;
+        WorldPacketPool::Release(packet);
     }
 }
 #endif
@@ -889,6 +898,8 @@ void WorldSession::ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket* pac
     }
 #endif /* ENABLE_ELUNA */
 
+    PerfScope perfScope(PERF_OPCODE, PERF_NO_MAP, packet->GetOpcode());
+
     // need prevent do internal far teleports in handlers because some handlers do lot steps
     // or call code that can do far teleports in some conditions unexpectedly for generic way work code
     if (_player)
@@ -31,7 +31,6 @@
 #include <ace/os_include/sys/os_socket.h>
 #include <ace/OS_NS_string.h>
 #include <ace/Reactor.h>
-#include <ace/Auto_Ptr.h>
 
 #include "WorldSocket.h"
 #include "Common.h"
@@ -39,6 +38,7 @@
 #include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include "WorldPacketPool.h"
 #include "SharedDefines.h"
 #include "ByteBuffer.h"
 #include "AddonHandler.h"
@@ -83,9 +83,8 @@ WorldSocket::WorldSocket(void) :
     m_LastPingTime(ACE_Time_Value::zero),
     m_OverSpeedPings(0),
     m_Session(0),
-    m_RecvWPct(0),
-    m_RecvPct(),
-    m_Header(sizeof(ClientPktHeader)),
+    m_RecvBuffer(16384),
+    m_RecvHeaderDecrypted(false),
     m_OutBufferLock(),
     m_OutBuffer(0),
     m_OutBufferSize(65536),
@@ -96,7 +95,10 @@ WorldSocket::WorldSocket(void) :
 
 WorldSocket::~WorldSocket(void)
 {
-    delete m_RecvWPct;
+    for (std::vector<WorldPacket*>::iterator itr = m_RecvBatch.begin(); itr != m_RecvBatch.end(); ++itr)
+    {
+        WorldPacketPool::Release(*itr);
+    }
 
     if (m_OutBuffer)
     {
@@ -148,13 +150,12 @@ int WorldSocket::SendPacket(const WorldPacket& pkt)
         return -1;
     }
 
-    WorldPacket pct = pkt;
-
-    if (iSendPacket(pct) == -1)
+    // a broadcast passes the same packet to every receiver, only copy it when it has to wait
+    if (iSendPacket(pkt) == -1)
     {
         WorldPacket* npct;
 
-        ACE_NEW_RETURN(npct, WorldPacket(pct), -1);
+        ACE_NEW_RETURN(npct, WorldPacket(pkt), -1);
 
         // NOTE maybe check of the size of the queue can be good ?
         // to make it bounded instead of unbounded
@@ -351,89 +352,70 @@ int WorldSocket::handle_close(ACE_HANDLE h, ACE_Reactor_Mask)
 }
 
 
-int WorldSocket::handle_input_header(void)
+int WorldSocket::handle_input_packets(void)
 {
-    MANGOS_ASSERT(m_RecvWPct == NULL);
-
-    MANGOS_ASSERT(m_Header.length() == sizeof(ClientPktHeader));
-
-    m_Crypt.DecryptRecv((uint8*) m_Header.rd_ptr(), sizeof(ClientPktHeader));
-
-    ClientPktHeader& header = *((ClientPktHeader*) m_Header.rd_ptr());
-
-    EndianConvertReverse(header.size);
-    EndianConvert(header.cmd);
+    // set errno properly here on error !!!
 
-    if ((header.size < 4) || (header.size > 10240) || (header.cmd  > 10240))
+    while (m_RecvBuffer.length() >= sizeof(ClientPktHeader))
     {
-        sLog.outError("WorldSocket::handle_input_header: client sent malformed packet size = %d , cmd = %d",
-                      header.size, header.cmd);
+        ClientPktHeader& header = *((ClientPktHeader*) m_RecvBuffer.rd_ptr());
 
-        errno = EINVAL;
-        return -1;
-    }
-
-    header.size -= 4;
+        // the header is decrypted in place, only once even if the payload is still incomplete
+        if (!m_RecvHeaderDecrypted)
+        {
+            m_Crypt.DecryptRecv((uint8*) m_RecvBuffer.rd_ptr(), sizeof(ClientPktHeader));
 
-    ACE_NEW_RETURN(m_RecvWPct, WorldPacket((uint16)header.cmd, header.size), -1);
+            EndianConvertReverse(header.size);
+            EndianConvert(header.cmd);
 
-    if (header.size > 0)
-    {
-        m_RecvWPct->resize(header.size);
-        m_RecvPct.base((char*) m_RecvWPct->contents(), m_RecvWPct->size());
-    }
-    else
-    {
-        MANGOS_ASSERT(m_RecvPct.space() == 0);
-    }
+            if ((header.size < 4) || (header.size > 10240) || (header.cmd  > 10240))
+            {
+                sLog.outError("WorldSocket::handle_input_packets: client sent malformed packet size = %d , cmd = %d",
+                              header.size, header.cmd);
 
-    return 0;
-}
+                errno = EINVAL;
+                return -1;
+            }
 
-int WorldSocket::handle_input_payload(void)
-{
-    // set errno properly here on error !!!
-    // now have a header and payload
+            m_RecvHeaderDecrypted = true;
+        }
 
-    MANGOS_ASSERT(m_RecvPct.space() == 0);
-    MANGOS_ASSERT(m_Header.space() == 0);
-    MANGOS_ASSERT(m_RecvWPct != NULL);
+        const size_t payloadSize = header.size - 4;
 
-    const int ret = ProcessIncoming(m_RecvWPct);
+        if (m_RecvBuffer.length() < sizeof(ClientPktHeader) + payloadSize)
+        {
+            // Couldn't receive the whole payload this time.
+            break;
+        }
 
-    m_RecvPct.base(NULL, 0);
-    m_RecvPct.reset();
-    m_RecvWPct = NULL;
+        WorldPacket* new_pct = WorldPacketPool::Acquire(uint16(header.cmd), payloadSize);
+        if (payloadSize > 0)
+        {
+            new_pct->append((uint8 const*)(m_RecvBuffer.rd_ptr() + sizeof(ClientPktHeader)), payloadSize);
+        }
 
-    m_Header.reset();
+        m_RecvBuffer.rd_ptr(sizeof(ClientPktHeader) + payloadSize);
+        m_RecvHeaderDecrypted = false;
 
-    if (ret == -1)
-    {
-        errno = EINVAL;
+        if (ProcessIncoming(new_pct) == -1)
+        {
+            errno = EINVAL;
+            return -1;
+        }
     }
 
-    return ret;
+    return 0;
 }
 
 int WorldSocket::handle_input_missing_data(void)
 {
-    char buf [4096];
+    // move the incomplete packet left over from the last call to the front of the buffer,
+    // the buffer can always hold the biggest client packet so there is room to receive
+    m_RecvBuffer.crunch();
 
-    ACE_Data_Block db(sizeof(buf),
-                      ACE_Message_Block::MB_DATA,
-                      buf,
-                      0,
-                      0,
-                      ACE_Message_Block::DONT_DELETE,
-                      0);
+    const size_t recv_size = m_RecvBuffer.space();
 
-    ACE_Message_Block message_block(&db,
-                                    ACE_Message_Block::DONT_DELETE,
-                                    0);
-
-    const size_t recv_size = message_block.space();
-
-    const ssize_t n = peer().recv(message_block.wr_ptr(),
+    const ssize_t n = peer().recv(m_RecvBuffer.wr_ptr(),
                                   recv_size);
 
     if (n <= 0)
@@ -441,69 +423,41 @@ int WorldSocket::handle_input_missing_data(void)
         return (int)n;
     }
 
-    message_block.wr_ptr(n);
+    m_RecvBuffer.wr_ptr(n);
 
-    while (message_block.length() > 0)
-    {
-        if (m_Header.space() > 0)
-        {
-            // need to receive the header
-            const size_t to_header = (message_block.length() > m_Header.space() ? m_Header.space() : message_block.length());
-            m_Header.copy(message_block.rd_ptr(), to_header);
-            message_block.rd_ptr(to_header);
+    const int ret = handle_input_packets();
 
-            if (m_Header.space() > 0)
-            {
-                // Couldn't receive the whole header this time.
-                MANGOS_ASSERT(message_block.length() == 0);
-                errno = EWOULDBLOCK;
-                return -1;
-            }
+    // hand whatever was decoded to the session, also when a later packet was bad
+    FlushRecvBatch();
 
-            // We just received nice new header
-            if (handle_input_header() == -1)
-            {
-                MANGOS_ASSERT((errno != EWOULDBLOCK) && (errno != EAGAIN));
-                return -1;
-            }
-        }
+    if (ret == -1)
+    {
+        MANGOS_ASSERT((errno != EWOULDBLOCK) && (errno != EAGAIN));
+        return -1;
+    }
 
-        // Its possible on some error situations that this happens
-        // for example on closing when epoll receives more chunked data and stuff
-        // hope this is not hack ,as proper m_RecvWPct is asserted around
-        if (!m_RecvWPct)
-        {
-            sLog.outError("Forcing close on input m_RecvWPct = NULL");
-            errno = EINVAL;
-            return -1;
-        }
+    return size_t(n) == recv_size ? 1 : 2;
+}
 
-        // We have full read header, now check the data payload
-        if (m_RecvPct.space() > 0)
-        {
-            // need more data in the payload
-            const size_t to_data = (message_block.length() > m_RecvPct.space() ? m_RecvPct.space() : message_block.length());
-            m_RecvPct.copy(message_block.rd_ptr(), to_data);
-            message_block.rd_ptr(to_data);
+void WorldSocket::FlushRecvBatch()
+{
+    if (m_RecvBatch.empty())
+    {
+        return;
+    }
 
-            if (m_RecvPct.space() > 0)
-            {
-                // Couldn't receive the whole data this time.
-                MANGOS_ASSERT(message_block.length() == 0);
-                errno = EWOULDBLOCK;
-                return -1;
-            }
-        }
+    if (m_Session && !closing_)
+    {
+        m_Session->QueuePackets(m_RecvBatch);
+        return;
+    }
 
-        // just received fresh new payload
-        if (handle_input_payload() == -1)
-        {
-            MANGOS_ASSERT((errno != EWOULDBLOCK) && (errno != EAGAIN));
-            return -1;
-        }
+    for (std::vector<WorldPacket*>::iterator itr = m_RecvBatch.begin(); itr != m_RecvBatch.end(); ++itr)
+    {
+        WorldPacketPool::Release(*itr);
     }
 
-    return size_t(n) == recv_size ? 1 : 2;
+    m_RecvBatch.clear();
 }
 
 int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
@@ -511,7 +465,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
     MANGOS_ASSERT(new_pct);
 
     // manage memory ;)
-    ACE_Auto_Ptr<WorldPacket> aptr(new_pct);
+    PooledPacketPtr aptr(new_pct);
 
     const ACE_UINT16 opcode = new_pct->GetOpcode();
 
@@ -566,9 +520,8 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             {
                 if (m_Session != NULL)
                 {
-                    // OK ,give the packet to WorldSession
-                    aptr.release();
-                    m_Session->QueuePacket(new_pct);
+                    // OK ,give the packet to WorldSession with the rest of this read
+                    m_RecvBatch.push_back(aptr.release());
                     return 0;
                 }
                 else
@@ -80,10 +80,11 @@ typedef ACE_Acceptor< WorldSocket, ACE_SOCK_ACCEPTOR > WorldAcceptor;
  *
  * The calls to Update () method are managed by WorldSocketMgr.
  *
- * For input, the class uses one 1024 bytes buffer on stack
- * to which it does recv() calls. And then received data is
- * distributed where its needed. 1024 matches pretty well the
- * traffic generated by client for now.
+ * For input, the class keeps one 16K buffer which is big enough
+ * for the biggest client packet, recv() goes straight into it and
+ * complete packets are decoded in place into pooled WorldPackets
+ * (see WorldPacketPool). Everything decoded from one recv() call
+ * is handed to the session with a single queue operation.
  *
  * The input/output do speculative reads/writes (AKA it tryes
  * to read all data available in the kernel buffer or tryes to
@@ -149,12 +150,14 @@ class WorldSocket : protected WorldHandler
 
     private:
         /// Helper functions for processing incoming data.
-        int handle_input_header(void);
-        int handle_input_payload(void);
+        int handle_input_packets(void);
         int handle_input_missing_data(void);
 
+        /// Queue m_RecvBatch to the session, or drop it if there is none.
+        void FlushRecvBatch();
+
         /// process one incoming packet.
-        /// @param new_pct received packet ,note that you need to delete it.
+        /// @param new_pct received packet from WorldPacketPool ,ownership is taken.
         int ProcessIncoming(WorldPacket* new_pct);
 
         /// Called by ProcessIncoming() on CMSG_AUTH_SESSION.
@@ -189,16 +192,14 @@ class WorldSocket : protected WorldHandler
         /// Session to which received packets are routed
         WorldSession* m_Session;
 
-        /// here are stored the fragments of the received data
-        WorldPacket* m_RecvWPct;
+        /// Received data not yet decoded, starts with a partial packet if any.
+        ACE_Message_Block m_RecvBuffer;
 
-        /// This block actually refers to m_RecvWPct contents,
-        /// which allows easy and safe writing to it.
-        /// It wont free memory when its deleted. m_RecvWPct takes care of freeing.
-        ACE_Message_Block m_RecvPct;
+        /// Header at the front of m_RecvBuffer is already decrypted.
+        bool m_RecvHeaderDecrypted;
 
-        /// Fragment of the received header.
-        ACE_Message_Block m_Header;
+        /// Packets decoded from the current recv() waiting for the session.
+        std::vector<WorldPacket*> m_RecvBatch;
 
         /// Mutex for protecting output related data.
         LockType m_OutBufferLock;
@@ -0,0 +1,482 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "TickProfiler.h"
+
+#include "Timer.h"
+#include "Config.h"
+#include "Log.h"
+#include "DBCStores.h"
+#include "Opcodes.h"
+
+#include <algorithm>
+#include <sstream>
+
+TickProfiler sTickProfiler;
+
+// RecordOpcode() indexes the opcode counters directly
+static_assert(MAX_PERF_OPCODES == NUM_MSG_TYPES, "profiler opcode counters must cover all opcodes");
+
+struct PerfSectionInfo
+{
+    char const* name;
+    PerfSection parent;
+};
+
+static PerfSectionInfo const perfSections[MAX_PERF_SECTIONS] =
+{
+    { "world",              PerfSection(PERF_NO_PARENT) },
+    { "world.sessions",     PERF_WORLD_UPDATE           },
+    { "world.maps",         PERF_WORLD_UPDATE           },
+    { "world.resultqueue",  PERF_WORLD_UPDATE           },
+    { "map",                PerfSection(PERF_NO_PARENT) },
+    { "map.sessions",       PERF_MAP_UPDATE             },
+    { "map.players",        PERF_MAP_UPDATE             },
+    { "map.transports",     PERF_MAP_UPDATE             },
+    { "map.cells",          PERF_MAP_UPDATE             },
+    { "map.objectupdates",  PERF_MAP_UPDATE             },
+    { "map.grids",          PERF_MAP_UPDATE             },
+    { "map.scripts",        PERF_MAP_UPDATE             },
+    { "opcode",             PerfSection(PERF_NO_PARENT) },
+};
+
+/// Summed counters of all threads
+struct PerfTotal
+{
+    uint32 id;
+    uint64 calls;
+    uint64 totalUs;
+    uint64 maxUs;
+
+    PerfTotal() : id(0), calls(0), totalUs(0), maxUs(0) {}
+
+    void Add(PerfCounter const& counter)
+    {
+        calls += counter.calls.load(std::memory_order_relaxed);
+        totalUs += counter.totalUs.load(std::memory_order_relaxed);
+        maxUs = std::max(maxUs, counter.maxUs.load(std::memory_order_relaxed));
+    }
+
+    /// most expensive first, used entries before unused ones
+    bool operator<(PerfTotal const& other) const
+    {
+        return totalUs != other.totalUs ? totalUs > other.totalUs : calls > other.calls;
+    }
+};
+
+static thread_local PerfThreadData* t_perfThreadData = NULL;
+
+TickProfiler::TickProfiler() : m_enabled(false), m_epoch(0), m_windowStart(0), m_dumpInterval(0), m_dumpTimer(0)
+{
+}
+
+void TickProfiler::LoadFromConfig()
+{
+    m_dumpInterval = sConfig.GetIntDefault("PerfLog.Interval", 60000);
+    m_dumpTimer = 0;
+    SetEnabled(sConfig.GetBoolDefault("PerfProfiler.Enabled", false));
+}
+
+void TickProfiler::SetEnabled(bool enabled)
+{
+    if (enabled && !IsEnabled())
+    {
+        Reset();
+    }
+
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void TickProfiler::Reset()
+{
+    m_windowStart = getMSTime();
+    m_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+PerfThreadData* TickProfiler::GetThreadData()
+{
+    PerfThreadData* data = t_perfThreadData;
+    if (!data)
+    {
+        data = new PerfThreadData();
+        data->epoch.store(m_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> guard(m_threadsLock);
+        data->index = m_threads.size();
+        m_threads.push_back(data);
+        t_perfThreadData = data;
+    }
+
+    // clear lazily on the owning thread, so counters keep a single writer
+    uint32 epoch = m_epoch.load(std::memory_order_relaxed);
+    if (data->epoch.load(std::memory_order_relaxed) != epoch)
+    {
+        for (uint32 i = 0; i < MAX_PERF_SECTIONS; ++i)
+        {
+            data->sections[i].Clear();
+        }
+        for (uint32 i = 0; i < MAX_PERF_MAP_IDS; ++i)
+        {
+            data->maps[i].Clear();
+        }
+        for (uint32 i = 0; i < MAX_PERF_OPCODES; ++i)
+        {
+            data->opcodes[i].Clear();
+        }
+        for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+        {
+            data->tierObjects[i].store(0, std::memory_order_relaxed);
+            data->tierUpdates[i].store(0, std::memory_order_relaxed);
+        }
+        data->epoch.store(epoch, std::memory_order_relaxed);
+    }
+
+    return data;
+}
+
+void TickProfiler::Record(PerfSection section, uint64 us)
+{
+    GetThreadData()->sections[section].Add(us);
+}
+
+void TickProfiler::RecordMap(uint32 mapId, uint64 us)
+{
+    GetThreadData()->maps[mapId].Add(us);
+}
+
+void TickProfiler::RecordOpcode(uint16 opcode, uint64 us)
+{
+    GetThreadData()->opcodes[opcode].Add(us);
+}
+
+void TickProfiler::RecordUpdateTiers(uint32 const* objects, uint32 const* updates)
+{
+    PerfThreadData* data = GetThreadData();
+    for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+    {
+        data->tierObjects[i].store(data->tierObjects[i].load(std::memory_order_relaxed) + objects[i], std::memory_order_relaxed);
+        data->tierUpdates[i].store(data->tierUpdates[i].load(std::memory_order_relaxed) + updates[i], std::memory_order_relaxed);
+    }
+}
+
+uint32 TickProfiler::GetWindowMs() const
+{
+    return std::max(getMSTimeDiff(m_windowStart, getMSTime()), uint32(1));
+}
+
+/// Sums the counters of all threads, skipping threads that did not record since the last reset
+static void SumThreads(std::vector<PerfThreadData*> const& threads, uint32 epoch,
+                       std::vector<PerfTotal>& sections, std::vector<PerfTotal>& maps, std::vector<PerfTotal>& opcodes)
+{
+    sections.assign(MAX_PERF_SECTIONS, PerfTotal());
+    maps.assign(MAX_PERF_MAP_IDS, PerfTotal());
+    opcodes.assign(MAX_PERF_OPCODES, PerfTotal());
+
+    for (uint32 i = 0; i < sections.size(); ++i)
+    {
+        sections[i].id = i;
+    }
+    for (uint32 i = 0; i < maps.size(); ++i)
+    {
+        maps[i].id = i;
+    }
+    for (uint32 i = 0; i < opcodes.size(); ++i)
+    {
+        opcodes[i].id = i;
+    }
+
+    for (std::vector<PerfThreadData*>::const_iterator itr = threads.begin(); itr != threads.end(); ++itr)
+    {
+        PerfThreadData const* data = *itr;
+        if (data->epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            continue;
+        }
+
+        for (uint32 i = 0; i < MAX_PERF_SECTIONS; ++i)
+        {
+            sections[i].Add(data->sections[i]);
+        }
+        for (uint32 i = 0; i < MAX_PERF_MAP_IDS; ++i)
+        {
+            maps[i].Add(data->maps[i]);
+        }
+        for (uint32 i = 0; i < MAX_PERF_OPCODES; ++i)
+        {
+            opcodes[i].Add(data->opcodes[i]);
+        }
+    }
+}
+
+static char const* const perfUpdateTierNames[MAX_PERF_UPDATE_TIERS] = { "near", "mid", "far" };
+
+/// Sums the update tier counters of all threads
+static void SumUpdateTiers(std::vector<PerfThreadData*> const& threads, uint32 epoch, uint64* objects, uint64* updates)
+{
+    for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+    {
+        objects[i] = 0;
+        updates[i] = 0;
+    }
+
+    for (std::vector<PerfThreadData*>::const_iterator itr = threads.begin(); itr != threads.end(); ++itr)
+    {
+        if ((*itr)->epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            continue;
+        }
+
+        for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+        {
+            objects[i] += (*itr)->tierObjects[i].load(std::memory_order_relaxed);
+            updates[i] += (*itr)->tierUpdates[i].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/// Time spent in the world loop or, for map worker threads, in map updates
+static uint64 GetThreadBusyUs(PerfThreadData const* data)
+{
+    // without worker threads maps update inside the world loop and are already counted there
+    if (uint64 worldUs = data->sections[PERF_WORLD_UPDATE].totalUs.load(std::memory_order_relaxed))
+    {
+        return worldUs;
+    }
+    return data->sections[PERF_MAP_UPDATE].totalUs.load(std::memory_order_relaxed);
+}
+
+static std::string GetPerfMapName(uint32 mapId)
+{
+    if (MapEntry const* entry = sMapStore.LookupEntry(mapId))
+    {
+        return entry->name[0];
+    }
+    return "unknown";
+}
+
+static void AppendJsonString(std::ostringstream& ss, std::string const& str)
+{
+    ss << '"';
+    for (std::string::const_iterator itr = str.begin(); itr != str.end(); ++itr)
+    {
+        if (*itr == '"' || *itr == '\\')
+        {
+            ss << '\\';
+        }
+        ss << *itr;
+    }
+    ss << '"';
+}
+
+static void AppendSection(std::vector<std::string>& lines, std::vector<PerfTotal> const& sections, uint32 section, uint32 depth, uint32 windowMs)
+{
+    PerfTotal const& total = sections[section];
+    if (total.calls)
+    {
+        char buf[256];
+        snprintf(buf, sizeof(buf), "%*s%-*s %8.1f ms/s  avg %7.3f ms  max %7.3f ms  calls " UI64FMTD,
+                 int(depth * 2), "", int(20 - depth * 2), perfSections[section].name,
+                 total.totalUs * 1.0 / windowMs, total.totalUs / 1000.0 / total.calls, total.maxUs / 1000.0, total.calls);
+        lines.push_back(buf);
+    }
+
+    for (uint32 i = 0; i < MAX_PERF_SECTIONS; ++i)
+    {
+        if (perfSections[i].parent == PerfSection(section))
+        {
+            AppendSection(lines, sections, i, depth + 1, windowMs);
+        }
+    }
+}
+
+void TickProfiler::BuildReport(std::vector<std::string>& lines, uint32 topCount) const
+{
+    uint32 windowMs = GetWindowMs();
+    uint32 epoch = m_epoch.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(m_threadsLock);
+
+    std::vector<PerfTotal> sections, maps, opcodes;
+    SumThreads(m_threads, epoch, sections, maps, opcodes);
+
+    char buf[256];
+    snprintf(buf, sizeof(buf), "Profiler %s, window %.1f s, %u threads", IsEnabled() ? "enabled" : "disabled", windowMs / 1000.0f, uint32(m_threads.size()));
+    lines.push_back(buf);
+
+    lines.push_back("Sections (time per second of wall clock):");
+    for (uint32 i = 0; i < MAX_PERF_SECTIONS; ++i)
+    {
+        if (perfSections[i].parent == PERF_NO_PARENT)
+        {
+            AppendSection(lines, sections, i, 1, windowMs);
+        }
+    }
+
+    lines.push_back("Threads:");
+    for (std::vector<PerfThreadData*>::const_iterator itr = m_threads.begin(); itr != m_threads.end(); ++itr)
+    {
+        if ((*itr)->epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            continue;
+        }
+
+        uint64 busyUs = GetThreadBusyUs(*itr);
+        snprintf(buf, sizeof(buf), "  #%-3u busy %5.1f%%", (*itr)->index, busyUs / 10.0 / windowMs);
+        lines.push_back(buf);
+    }
+
+    uint64 tierObjects[MAX_PERF_UPDATE_TIERS], tierUpdates[MAX_PERF_UPDATE_TIERS];
+    SumUpdateTiers(m_threads, epoch, tierObjects, tierUpdates);
+    if (uint64 cellVisits = sections[PERF_MAP_CELLS].calls)
+    {
+        lines.push_back("Update tiers (per map update):");
+        for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+        {
+            snprintf(buf, sizeof(buf), "  %-6s %10.1f objects %10.1f updated",
+                     perfUpdateTierNames[i], tierObjects[i] * 1.0 / cellVisits, tierUpdates[i] * 1.0 / cellVisits);
+            lines.push_back(buf);
+        }
+    }
+
+    std::sort(maps.begin(), maps.end());
+    lines.push_back("Top maps:");
+    for (uint32 i = 0; i < topCount && i < maps.size() && maps[i].calls; ++i)
+    {
+        snprintf(buf, sizeof(buf), "  %4u %-24s %8.1f ms/s  avg %7.3f ms  max %7.3f ms",
+                 maps[i].id, GetPerfMapName(maps[i].id).c_str(), maps[i].totalUs * 1.0 / windowMs,
+                 maps[i].totalUs / 1000.0 / maps[i].calls, maps[i].maxUs / 1000.0);
+        lines.push_back(buf);
+    }
+
+    std::sort(opcodes.begin(), opcodes.end());
+    lines.push_back("Top opcodes:");
+    for (uint32 i = 0; i < topCount && i < opcodes.size() && opcodes[i].calls; ++i)
+    {
+        snprintf(buf, sizeof(buf), "  %-32s %8.1f ms/s  avg %7.3f ms  max %7.3f ms  calls " UI64FMTD,
+                 LookupOpcodeName(opcodes[i].id), opcodes[i].totalUs * 1.0 / windowMs,
+                 opcodes[i].totalUs / 1000.0 / opcodes[i].calls, opcodes[i].maxUs / 1000.0, opcodes[i].calls);
+        lines.push_back(buf);
+    }
+}
+
+std::string TickProfiler::BuildJson(bool multiline) const
+{
+    char const* nl = multiline ? "\n" : "";
+
+    uint32 windowMs = GetWindowMs();
+    uint32 epoch = m_epoch.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(m_threadsLock);
+
+    std::vector<PerfTotal> sections, maps, opcodes;
+    SumThreads(m_threads, epoch, sections, maps, opcodes);
+
+    std::ostringstream ss;
+    ss << "{" << nl << "\"time\":" << uint64(time(NULL)) << "," << nl << "\"windowMs\":" << windowMs << "," << nl << "\"sections\":{";
+
+    bool first = true;
+    for (uint32 i = 0; i < MAX_PERF_SECTIONS; ++i)
+    {
+        if (!sections[i].calls)
+        {
+            continue;
+        }
+
+        ss << (first ? "" : ",") << nl << "\"" << perfSections[i].name << "\":{\"calls\":" << sections[i].calls
+           << ",\"totalUs\":" << sections[i].totalUs << ",\"maxUs\":" << sections[i].maxUs << "}";
+        first = false;
+    }
+
+    ss << nl << "}," << nl << "\"threads\":[";
+    first = true;
+    for (std::vector<PerfThreadData*>::const_iterator itr = m_threads.begin(); itr != m_threads.end(); ++itr)
+    {
+        if ((*itr)->epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            continue;
+        }
+
+        ss << (first ? "" : ",") << nl << "{\"index\":" << (*itr)->index << ",\"busyUs\":" << GetThreadBusyUs(*itr) << "}";
+        first = false;
+    }
+
+    uint64 tierObjects[MAX_PERF_UPDATE_TIERS], tierUpdates[MAX_PERF_UPDATE_TIERS];
+    SumUpdateTiers(m_threads, epoch, tierObjects, tierUpdates);
+
+    ss << nl << "]," << nl << "\"updateTiers\":{";
+    for (uint32 i = 0; i < MAX_PERF_UPDATE_TIERS; ++i)
+    {
+        ss << (i ? "," : "") << nl << "\"" << perfUpdateTierNames[i] << "\":{\"objects\":" << tierObjects[i] << ",\"updates\":" << tierUpdates[i] << "}";
+    }
+
+    ss << nl << "}," << nl << "\"maps\":[";
+    first = true;
+    for (uint32 i = 0; i < maps.size(); ++i)
+    {
+        if (!maps[i].calls)
+        {
+            continue;
+        }
+
+        ss << (first ? "" : ",") << nl << "{\"id\":" << maps[i].id << ",\"name\":";
+        AppendJsonString(ss, GetPerfMapName(maps[i].id));
+        ss << ",\"calls\":" << maps[i].calls << ",\"totalUs\":" << maps[i].totalUs << ",\"maxUs\":" << maps[i].maxUs << "}";
+        first = false;
+    }
+
+    ss << nl << "]," << nl << "\"opcodes\":[";
+    first = true;
+    for (uint32 i = 0; i < opcodes.size(); ++i)
+    {
+        if (!opcodes[i].calls)
+        {
+            continue;
+        }
+
+        ss << (first ? "" : ",") << nl << "{\"opcode\":\"" << LookupOpcodeName(opcodes[i].id) << "\",\"calls\":" << opcodes[i].calls
+           << ",\"totalUs\":" << opcodes[i].totalUs << ",\"maxUs\":" << opcodes[i].maxUs << "}";
+        first = false;
+    }
+
+    ss << nl << "]" << nl << "}";
+    return ss.str();
+}
+
+void TickProfiler::Update(uint32 diff)
+{
+    if (!IsEnabled() || !m_dumpInterval)
+    {
+        return;
+    }
+
+    m_dumpTimer += diff;
+    if (m_dumpTimer < m_dumpInterval)
+    {
+        return;
+    }
+
+    m_dumpTimer = 0;
+    sLog.outPerf(BuildJson().c_str());
+    Reset();
+}
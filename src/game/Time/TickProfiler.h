@@ -0,0 +1,225 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef TICKPROFILER_H
+#define TICKPROFILER_H
+
+#include "Common.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Instrumented parts of the world tick.
+ *
+ * Sections form a tree (see the parent table in TickProfiler.cpp), a child is
+ * always timed inside its parent so the report can show both.
+ */
+enum PerfSection
+{
+    PERF_WORLD_UPDATE,              ///< World::Update
+    PERF_WORLD_SESSIONS,            ///< World::UpdateSessions
+    PERF_WORLD_MAPS,                ///< MapManager::Update, including the wait for map workers
+    PERF_WORLD_RESULT_QUEUE,        ///< async SQL callbacks
+    PERF_MAP_UPDATE,                ///< Map::Update, on whichever thread runs it
+    PERF_MAP_SESSIONS,              ///< map bound WorldSession::Update
+    PERF_MAP_PLAYERS,               ///< Player::Update
+    PERF_MAP_TRANSPORTS,            ///< local transports
+    PERF_MAP_CELLS,                 ///< active cell visits around players and active objects
+    PERF_MAP_OBJECT_UPDATES,        ///< Map::SendObjectUpdates
+    PERF_MAP_GRIDS,                 ///< grid state machine
+    PERF_MAP_SCRIPTS,               ///< map scripts, instance data and weather
+    PERF_OPCODE,                    ///< WorldSession::ExecuteOpcode, broken down per opcode
+    MAX_PERF_SECTIONS
+};
+
+#define PERF_NO_PARENT      MAX_PERF_SECTIONS
+#define MAX_PERF_MAP_IDS    1024
+#define PERF_NO_MAP         MAX_PERF_MAP_IDS
+#define MAX_PERF_OPCODES    0x424   // NUM_MSG_TYPES, kept literal so this header stays independent of Opcodes.h, checked in TickProfiler.cpp
+#define MAX_PERF_UPDATE_TIERS 3     // MAX_UPDATE_LOD_TIERS, checked where Map::Update records them
+
+/**
+ * @brief Call count and time of one timed scope. Only its owning thread writes it.
+ */
+struct PerfCounter
+{
+    std::atomic<uint64> calls;
+    std::atomic<uint64> totalUs;
+    std::atomic<uint64> maxUs;
+
+    void Add(uint64 us)
+    {
+        // single writer, relaxed load + store is enough and avoids locked instructions
+        calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        totalUs.store(totalUs.load(std::memory_order_relaxed) + us, std::memory_order_relaxed);
+        if (us > maxUs.load(std::memory_order_relaxed))
+        {
+            maxUs.store(us, std::memory_order_relaxed);
+        }
+    }
+
+    void Clear()
+    {
+        calls.store(0, std::memory_order_relaxed);
+        totalUs.store(0, std::memory_order_relaxed);
+        maxUs.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Counters of one thread. Allocated on the first timed scope and never freed.
+ */
+struct PerfThreadData
+{
+    uint32 index;
+    std::atomic<uint32> epoch;                                  ///< window the counters belong to, written by the owning thread
+    PerfCounter sections[MAX_PERF_SECTIONS];
+    PerfCounter maps[MAX_PERF_MAP_IDS];
+    PerfCounter opcodes[MAX_PERF_OPCODES];
+    std::atomic<uint64> tierObjects[MAX_PERF_UPDATE_TIERS];    ///< objects in the active cells, summed over map updates
+    std::atomic<uint64> tierUpdates[MAX_PERF_UPDATE_TIERS];    ///< how many of them were updated
+};
+
+/**
+ * @brief Low overhead hierarchical profiler for the world and map update loops.
+ *
+ * Every thread accumulates into its own PerfThreadData, so recording never
+ * takes a lock. Readers sum all threads; values may be one scope behind.
+ */
+class TickProfiler
+{
+    public:
+        TickProfiler();
+
+        void LoadFromConfig();
+
+        bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+        void SetEnabled(bool enabled);
+
+        /// Starts a new measuring window. Threads clear their counters on their next record.
+        void Reset();
+
+        void Record(PerfSection section, uint64 us);
+        void RecordMap(uint32 mapId, uint64 us);
+        void RecordOpcode(uint16 opcode, uint64 us);
+        /// Adds the per tier object and update counts of one Map::Update.
+        void RecordUpdateTiers(uint32 const* objects, uint32 const* updates);
+
+        /// Human readable report, one line per entry, at most @p topCount maps and opcodes.
+        void BuildReport(std::vector<std::string>& lines, uint32 topCount) const;
+        /// JSON object with all non-zero counters, on one line or with every member and array element on its own line.
+        std::string BuildJson(bool multiline = false) const;
+
+        /// Writes BuildJson() to the perf log every PerfLog.Interval ms.
+        void Update(uint32 diff);
+
+    private:
+        PerfThreadData* GetThreadData();
+        uint32 GetWindowMs() const;
+
+        std::atomic<bool> m_enabled;
+        std::atomic<uint32> m_epoch;
+        uint32 m_windowStart;
+
+        uint32 m_dumpInterval;
+        uint32 m_dumpTimer;
+
+        mutable std::mutex m_threadsLock;   // registration and reports only
+        std::vector<PerfThreadData*> m_threads;
+};
+
+extern TickProfiler sTickProfiler;
+
+/**
+ * @brief Times the enclosing scope into a PerfSection (and optionally a map or opcode bucket).
+ *
+ * Next() closes the current section and starts another one, for functions
+ * that run several phases in sequence.
+ */
+class PerfScope
+{
+    public:
+        explicit PerfScope(PerfSection section) : m_section(section), m_mapId(PERF_NO_MAP), m_opcode(MAX_PERF_OPCODES)
+        {
+            Start();
+        }
+
+        PerfScope(PerfSection section, uint32 mapId, uint16 opcode = MAX_PERF_OPCODES) : m_section(section), m_mapId(mapId), m_opcode(opcode)
+        {
+            Start();
+        }
+
+        ~PerfScope() { Stop(); }
+
+        void Next(PerfSection section)
+        {
+            Stop();
+            m_section = section;
+            m_mapId = PERF_NO_MAP;
+            m_opcode = MAX_PERF_OPCODES;
+            Start();
+        }
+
+    private:
+        void Start()
+        {
+            m_active = sTickProfiler.IsEnabled();
+            if (m_active)
+            {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        void Stop()
+        {
+            if (!m_active)
+            {
+                return;
+            }
+
+            uint64 us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+            sTickProfiler.Record(m_section, us);
+            if (m_mapId < MAX_PERF_MAP_IDS)
+            {
+                sTickProfiler.RecordMap(m_mapId, us);
+            }
+            if (m_opcode < MAX_PERF_OPCODES)
+            {
+                sTickProfiler.RecordOpcode(m_opcode, us);
+            }
+            m_active = false;
+        }
+
+        PerfSection m_section;
+        uint32 m_mapId;
+        uint16 m_opcode;
+        bool m_active;
+        std::chrono::steady_clock::time_point m_start;
+};
+
+#endif
@@ -28,7 +28,12 @@
 #include "SQLStorages.h"
 #include "UpdateFields.h"
 #include "ObjectMgr.h"
+#include "CharacterDirectory.h"
 #include "AccountMgr.h"
+#include "Util.h"
+
+#include <atomic>
+#include <thread>
 
 // Character Dump tables
 struct DumpTable
@@ -66,6 +71,184 @@ static DumpTable dumpTables[] =
     { NULL,                               DTT_CHAR_TABLE }, // end marker
 };
 
+static DumpTable const* FindDumpTable(std::string const& name)
+{
+    for (DumpTable const* itr = &dumpTables[0]; itr->isValid(); ++itr)
+    {
+        if (name == itr->name)
+        {
+            return itr;
+        }
+    }
+
+    return NULL;
+}
+
+// Binary dump format
+#define PLAYER_DUMP_MAGIC           "MPDB"
+#define PLAYER_DUMP_MAGIC_SIZE      4
+#define PLAYER_DUMP_FORMAT_VERSION  1
+#define PLAYER_DUMP_NULL_VALUE      0xFFFFFFFF              // value length of NULL fields
+#define PLAYER_DUMP_MAX_VALUE_SIZE  (16 * 1024 * 1024)      // larger lengths mean a broken file
+#define PLAYER_DUMP_FILE_BUFFER     (64 * 1024)
+#define PLAYER_DUMP_INSERT_ROWS     100                     // rows per multi-row INSERT at load
+
+enum DumpBlock
+{
+    DUMP_BLOCK_END          = 0,                            // end of the dump
+    DUMP_BLOCK_TABLE        = 1,                            // table name, column count, column names
+    DUMP_BLOCK_ROW          = 2,                            // one value per column
+    DUMP_BLOCK_TABLE_END    = 3
+};
+
+/// Buffered little endian reads and writes of the binary dump format.
+class PlayerDumpFile
+{
+    public:
+        explicit PlayerDumpFile(FILE* file) : m_file(file) {}
+
+        void WriteBytes(char const* data, uint32 size) { fwrite(data, 1, size, m_file); }
+        void WriteUInt8(uint8 value) { fputc(value, m_file); }
+        void WriteUInt32(uint32 value)
+        {
+            uint8 bytes[4] = { uint8(value), uint8(value >> 8), uint8(value >> 16), uint8(value >> 24) };
+            fwrite(bytes, 1, 4, m_file);
+        }
+        void WriteString(std::string const& str)
+        {
+            WriteUInt32(str.size());
+            WriteBytes(str.c_str(), str.size());
+        }
+        void WriteValue(Field const& field)
+        {
+            if (field.IsNULL())
+            {
+                WriteUInt32(PLAYER_DUMP_NULL_VALUE);
+                return;
+            }
+
+            uint32 size = strlen(field.GetString());
+            WriteUInt32(size);
+            WriteBytes(field.GetString(), size);
+        }
+
+        bool ReadBytes(char* data, uint32 size) { return fread(data, 1, size, m_file) == size; }
+        bool ReadUInt8(uint8& value)
+        {
+            int c = fgetc(m_file);
+            value = uint8(c);
+            return c != EOF;
+        }
+        bool ReadUInt32(uint32& value)
+        {
+            uint8 bytes[4];
+            if (fread(bytes, 1, 4, m_file) != 4)
+            {
+                return false;
+            }
+
+            value = uint32(bytes[0]) | (uint32(bytes[1]) << 8) | (uint32(bytes[2]) << 16) | (uint32(bytes[3]) << 24);
+            return true;
+        }
+        /// @param isNull set for NULL values, which need no string
+        bool ReadValue(std::string& str, bool& isNull)
+        {
+            uint32 size;
+            if (!ReadUInt32(size))
+            {
+                return false;
+            }
+
+            isNull = size == PLAYER_DUMP_NULL_VALUE;
+            if (isNull)
+            {
+                str.clear();
+                return true;
+            }
+
+            if (size > PLAYER_DUMP_MAX_VALUE_SIZE)
+            {
+                return false;
+            }
+
+            str.resize(size);
+            return !size || ReadBytes(&str[0], size);
+        }
+        bool ReadString(std::string& str)
+        {
+            bool isNull;
+            return ReadValue(str, isNull) && !isNull;
+        }
+
+        bool HasError() const { return ferror(m_file) != 0; }
+
+    private:
+        FILE* m_file;
+};
+
+/// How a column of a binary dump is changed to server values at load.
+enum DumpColumnRemap
+{
+    DUMP_REMAP_CHARACTER,                                   // new character guid
+    DUMP_REMAP_ACCOUNT,                                     // target account
+    DUMP_REMAP_NAME,                                        // given name, or rename on login for taken names
+    DUMP_REMAP_ITEM,                                        // new item guid
+    DUMP_REMAP_ITEM_NONZERO,                                // new item guid, 0 stays 0
+    DUMP_REMAP_ITEM_DATA,                                   // item guid and owner in item_instance.data
+    DUMP_REMAP_MAIL,                                        // new mail id
+    DUMP_REMAP_NEW_PET,                                     // new pet number, taken for each pet of character_pet
+    DUMP_REMAP_PET                                          // pet number taken by character_pet
+};
+
+struct DumpColumnRemapInfo
+{
+    DumpTableType type;
+    char const* column;
+    DumpColumnRemap remap;
+};
+
+static DumpColumnRemapInfo const dumpColumnRemaps[] =
+{
+    { DTT_CHARACTER,  "guid",       DUMP_REMAP_CHARACTER    },
+    { DTT_CHARACTER,  "account",    DUMP_REMAP_ACCOUNT      },
+    { DTT_CHARACTER,  "name",       DUMP_REMAP_NAME         },
+    { DTT_CHAR_TABLE, "guid",       DUMP_REMAP_CHARACTER    },
+    { DTT_INVENTORY,  "guid",       DUMP_REMAP_CHARACTER    },
+    { DTT_INVENTORY,  "bag",        DUMP_REMAP_ITEM_NONZERO },
+    { DTT_INVENTORY,  "item",       DUMP_REMAP_ITEM         },
+    { DTT_MAIL,       "id",         DUMP_REMAP_MAIL         },
+    { DTT_MAIL,       "receiver",   DUMP_REMAP_CHARACTER    },
+    { DTT_MAIL_ITEM,  "mail_id",    DUMP_REMAP_MAIL         },
+    { DTT_MAIL_ITEM,  "item_guid",  DUMP_REMAP_ITEM         },
+    { DTT_MAIL_ITEM,  "receiver",   DUMP_REMAP_CHARACTER    },
+    { DTT_ITEM,       "guid",       DUMP_REMAP_ITEM         },
+    { DTT_ITEM,       "owner_guid", DUMP_REMAP_CHARACTER    },
+    { DTT_ITEM,       "data",       DUMP_REMAP_ITEM_DATA    },
+    { DTT_ITEM_GIFT,  "guid",       DUMP_REMAP_CHARACTER    },
+    { DTT_ITEM_GIFT,  "item_guid",  DUMP_REMAP_ITEM         },
+    { DTT_ITEM_LOOT,  "guid",       DUMP_REMAP_ITEM         },
+    { DTT_ITEM_LOOT,  "owner_guid", DUMP_REMAP_CHARACTER    },
+    { DTT_PET,        "id",         DUMP_REMAP_NEW_PET      },
+    { DTT_PET,        "owner",      DUMP_REMAP_CHARACTER    },
+    { DTT_PET_TABLE,  "guid",       DUMP_REMAP_PET          },
+};
+
+/// version and structure of the character DB, as "version.structure.X"
+static std::string GetCharacterDbVersion()
+{
+    QueryResult* result = CharacterDatabase.Query("SELECT `version`, `structure` FROM `db_version` ORDER BY `version` DESC, `structure` DESC, `content` ASC LIMIT 1");
+    if (!result)
+    {
+        sLog.outError("Character DB not have 'db_version' table");
+        return "";
+    }
+
+    Field* fields = result->Fetch();
+    std::string dbversion = std::to_string(fields[0].GetInt16()) + "." + std::to_string(fields[1].GetInt16()) + ".X";
+    delete result;
+    return dbversion;
+}
+
 // Low level functions
 static bool findtoknth(std::string& str, int n, std::string::size_type& s, std::string::size_type& e)
 {
@@ -307,44 +490,48 @@ std::string PlayerDumpWriter::GenerateWhereStr(char const* field, GUIDs const& g
     return wherestr.str();
 }
 
-void StoreGUID(QueryResult* result, uint32 field, std::set<uint32>& guids)
+// Writing - High-level functions
+char const* PlayerDumpWriter::GetKeyField(DumpTableType type, GUIDs const*& guids) const
 {
-    Field* fields = result->Fetch();
-    uint32 guid = fields[field].GetUInt32();
-    if (guid)
+    guids = NULL;
+
+    switch (type)
     {
-        guids.insert(guid);
+        case DTT_ITEM:      guids = &items; return "guid";
+        case DTT_ITEM_GIFT: guids = &items; return "item_guid";
+        case DTT_ITEM_LOOT: guids = &items; return "guid";
+        case DTT_PET:                       return "owner";
+        case DTT_PET_TABLE: guids = &pets;  return "guid";
+        case DTT_MAIL:                      return "receiver";
+        case DTT_MAIL_ITEM: guids = &mails; return "mail_id";
+        default:                            return "guid";
     }
 }
 
-void StoreGUID(QueryResult* result, uint32 data, uint32 field, std::set<uint32>& guids)
+void PlayerDumpWriter::StoreGUIDs(DumpTableType type, Field* fields)
 {
-    Field* fields = result->Fetch();
-    std::string dataStr = fields[data].GetCppString();
-    uint32 guid = atoi(gettoknth(dataStr, field).c_str());
+    uint32 guid = 0;
+    GUIDs* guids = NULL;
+
+    switch (type)
+    {
+        case DTT_INVENTORY: guid = fields[3].GetUInt32(); guids = &items; break;   // item guid collection (character_inventory.item)
+        case DTT_PET:       guid = fields[0].GetUInt32(); guids = &pets;  break;   // pet petnumber collection (character_pet.id)
+        case DTT_MAIL:      guid = fields[0].GetUInt32(); guids = &mails; break;   // mail id collection (mail.id)
+        case DTT_MAIL_ITEM: guid = fields[1].GetUInt32(); guids = &items; break;   // item guid collection (mail_items.item_guid)
+        default:                                                          break;
+    }
+
     if (guid)
     {
-        guids.insert(guid);
+        guids->insert(guid);
     }
 }
 
-// Writing - High-level functions
 void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type)
 {
-    GUIDs const* guids = NULL;
-    char const* fieldname;
-
-    switch (type)
-    {
-        case DTT_ITEM:      fieldname = "guid";      guids = &items; break;
-        case DTT_ITEM_GIFT: fieldname = "item_guid"; guids = &items; break;
-        case DTT_ITEM_LOOT: fieldname = "guid";      guids = &items; break;
-        case DTT_PET:       fieldname = "owner";                     break;
-        case DTT_PET_TABLE: fieldname = "guid";      guids = &pets;  break;
-        case DTT_MAIL:      fieldname = "receiver";                  break;
-        case DTT_MAIL_ITEM: fieldname = "mail_id";   guids = &mails; break;
-        default:            fieldname = "guid";                      break;
-    }
+    GUIDs const* guids;
+    char const* fieldname = GetKeyField(type, guids);
 
     // for guid set stop if set is empty
     if (guids && guids->empty())
@@ -404,19 +591,7 @@ void PlayerDumpWriter::DumpTableContent(std::string& dump, uint32 guid, char con
 
         do
         {
-            // collect guids
-            switch (type)
-            {
-                case DTT_INVENTORY:
-                    StoreGUID(result, 3, items); break;     // item guid collection
-                case DTT_PET:
-                    StoreGUID(result, 0, pets);  break;     // pet petnumber collection (character_pet.id)
-                case DTT_MAIL:
-                    StoreGUID(result, 0, mails);            // mail id collection (mail.id)
-                case DTT_MAIL_ITEM:
-                    StoreGUID(result, 1, items); break;     // item guid collection (mail_items.item_guid)
-                default:                       break;
-            }
+            StoreGUIDs(type, result->Fetch());
 
             dump += CreateDumpString(tableTo, tableColumnNamesStr.c_str(), result);
             dump += "\n";
@@ -469,23 +644,198 @@ std::string PlayerDumpWriter::GetDump(uint32 guid)
     return dump;
 }
 
+void PlayerDumpWriter::WriteTableContent(PlayerDumpFile& out, uint32 guid, char const* table, DumpTableType type)
+{
+    GUIDs const* guids;
+    char const* fieldname = GetKeyField(type, guids);
+
+    // for guid set stop if set is empty
+    if (guids && guids->empty())
+    {
+        return;                                              // nothing to do
+    }
+
+    GUIDs::const_iterator guids_itr;
+    if (guids)
+    {
+        guids_itr = guids->begin();
+    }
+
+    bool started = false;
+    do
+    {
+        std::string wherestr = guids ? GenerateWhereStr(fieldname, *guids, guids_itr) : GenerateWhereStr(fieldname, guid);
+
+        QueryNamedResult* result = CharacterDatabase.PQueryNamed("SELECT * FROM `%s` WHERE %s", table, wherestr.c_str());
+        if (!result)
+        {
+            continue;
+        }
+
+        // the table block starts with its first rows, tables without rows are left out
+        if (!started)
+        {
+            QueryFieldNames const& names = result->GetFieldNames();
+
+            out.WriteUInt8(DUMP_BLOCK_TABLE);
+            out.WriteString(table);
+            out.WriteUInt32(names.size());
+            for (QueryFieldNames::const_iterator itr = names.begin(); itr != names.end(); ++itr)
+            {
+                out.WriteString(*itr);
+            }
+
+            started = true;
+        }
+
+        do
+        {
+            Field* fields = result->Fetch();
+            StoreGUIDs(type, fields);
+
+            out.WriteUInt8(DUMP_BLOCK_ROW);
+            for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+            {
+                out.WriteValue(fields[i]);
+            }
+        }
+        while (result->NextRow());
+
+        delete result;
+    }
+    while (guids && guids_itr != guids->end());             // not set case iterate single time, set case iterate for all guids
+
+    if (started)
+    {
+        out.WriteUInt8(DUMP_BLOCK_TABLE_END);
+    }
+}
+
 DumpReturn PlayerDumpWriter::WriteDump(const std::string& file, uint32 guid)
 {
-    FILE* fout = fopen(file.c_str(), "w");
+    FILE* fout = fopen(file.c_str(), "wb");
     if (!fout)
     {
         return DUMP_FILE_OPEN_ERROR;
     }
 
-    std::string dump = GetDump(guid);
+    setvbuf(fout, NULL, _IOFBF, PLAYER_DUMP_FILE_BUFFER);
 
-    fprintf(fout, "%s\n", dump.c_str());
-    fclose(fout);
-    return DUMP_SUCCESS;
+    PlayerDumpFile out(fout);
+    out.WriteBytes(PLAYER_DUMP_MAGIC, PLAYER_DUMP_MAGIC_SIZE);
+    out.WriteUInt32(PLAYER_DUMP_FORMAT_VERSION);
+    out.WriteString(GetCharacterDbVersion());
+
+    for (DumpTable* itr = &dumpTables[0]; itr->isValid(); ++itr)
+    {
+        WriteTableContent(out, guid, itr->name, itr->type);
+    }
+
+    out.WriteUInt8(DUMP_BLOCK_END);
+
+    bool failed = out.HasError();
+    if (fclose(fout) != 0)
+    {
+        failed = true;
+    }
+
+    return failed ? DUMP_FILE_BROKEN : DUMP_SUCCESS;
+}
+
+static std::thread s_dumpJob;
+static std::atomic<bool> s_dumpJobRunning(false);
+
+uint32 PlayerDumpWriter::WriteDumps(DumpFileList const& dumps, uint32 threads)
+{
+    std::atomic<size_t> next(0);
+    std::atomic<uint32> written(0);
+    std::atomic<uint32> failed(0);
+    uint32 step = std::max(uint32(dumps.size() / 10), 1u);
+
+    // every thread takes the next dump until none is left
+    auto writeDumps = [&dumps, &next, &written, &failed, step]()
+    {
+        for (size_t i = next++; i < dumps.size(); i = next++)
+        {
+            if (PlayerDumpWriter().WriteDump(dumps[i].second, dumps[i].first) != DUMP_SUCCESS)
+            {
+                sLog.outError("PlayerDumpWriter: Can't write the dump of character %u to '%s'", dumps[i].first, dumps[i].second.c_str());
+                ++failed;
+            }
+
+            uint32 done = ++written;
+            if (done % step == 0 && done < dumps.size())
+            {
+                sLog.outString("PlayerDumpWriter: %u of %u character dumps written", done, uint32(dumps.size()));
+            }
+        }
+    };
+
+    // more threads than query connections would only wait for each other
+    threads = std::min(threads, uint32(dumps.size()));
+    threads = std::min(threads, uint32(std::max(CharacterDatabase.GetQueryConnectionCount(), 1)));
+    if (threads <= 1)
+    {
+        writeDumps();
+        return failed;
+    }
+
+    std::vector<std::thread> workers;
+    for (uint32 i = 0; i < threads; ++i)
+    {
+        workers.push_back(std::thread([&writeDumps]()
+        {
+            CharacterDatabase.ThreadStart();
+            writeDumps();
+            CharacterDatabase.ThreadEnd();
+        }));
+    }
+
+    for (std::vector<std::thread>::iterator itr = workers.begin(); itr != workers.end(); ++itr)
+    {
+        itr->join();
+    }
+
+    return failed;
+}
+
+bool PlayerDumpWriter::StartDumps(DumpFileList const& dumps, uint32 threads)
+{
+    if (s_dumpJobRunning.exchange(true))
+    {
+        return false;
+    }
+
+    // the previous job has finished, only its thread is left to collect
+    if (s_dumpJob.joinable())
+    {
+        s_dumpJob.join();
+    }
+
+    s_dumpJob = std::thread([dumps, threads]()
+    {
+        CharacterDatabase.ThreadStart();
+        sLog.outString("PlayerDumpWriter: Writing %u character dumps", uint32(dumps.size()));
+        uint32 failed = WriteDumps(dumps, threads);
+        sLog.outString("PlayerDumpWriter: Wrote %u character dumps, %u failed", uint32(dumps.size()) - failed, failed);
+        CharacterDatabase.ThreadEnd();
+
+        s_dumpJobRunning = false;
+    });
+
+    return true;
+}
+
+void PlayerDumpWriter::WaitDumps()
+{
+    if (s_dumpJob.joinable())
+    {
+        s_dumpJob.join();
+    }
 }
 
 // Reading - High-level functions
-#define ROLLBACK(DR) {CharacterDatabase.RollbackTransaction(); fclose(fin); return (DR);}
+#define ROLLBACK(DR) {CharacterDatabase.RollbackTransaction(); return (DR);}
 
 DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, std::string name, uint32 guid)
 {
@@ -496,14 +846,15 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
         return DUMP_TOO_MANY_CHARS;
     }
 
-    FILE* fin = fopen(file.c_str(), "r");
+    FILE* fin = fopen(file.c_str(), "rb");
     if (!fin)
     {
         return DUMP_FILE_OPEN_ERROR;
     }
 
+    setvbuf(fin, NULL, _IOFBF, PLAYER_DUMP_FILE_BUFFER);
+
     QueryResult* result;
-    char newguid[20], chraccount[20], newpetid[20], currpetid[20], lastpetid[20];
 
     // make sure the same guid doesn't already exist and is safe to use
     bool incHighest = true;
@@ -548,6 +899,48 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
 
     // name encoded or empty
 
+    uint32 itemCount = 0;
+    uint32 mailCount = 0;
+    DumpReturn dumpResult;
+
+    PlayerDumpFile in(fin);
+    char magic[PLAYER_DUMP_MAGIC_SIZE];
+    if (in.ReadBytes(magic, PLAYER_DUMP_MAGIC_SIZE) && !memcmp(magic, PLAYER_DUMP_MAGIC, PLAYER_DUMP_MAGIC_SIZE))
+    {
+        dumpResult = LoadBinaryDump(in, account, name, guid, itemCount, mailCount);
+    }
+    else
+    {
+        rewind(fin);
+        dumpResult = LoadTextDump(fin, account, name, guid, itemCount, mailCount);
+    }
+
+    fclose(fin);
+
+    if (dumpResult != DUMP_SUCCESS)
+    {
+        return dumpResult;
+    }
+
+    sCharacterDirectory.ReloadCharacter(guid);
+
+    // FIXME: current code with post-updating guids not safe for future per-map threads
+    sObjectMgr.m_ItemGuids.Set(sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed() + itemCount);
+    sObjectMgr.m_MailIds.Set(sObjectMgr.m_MailIds.GetNextAfterMaxUsed() + mailCount);
+
+    if (incHighest)
+    {
+        sObjectMgr.m_CharGuids.Set(sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + 1);
+    }
+
+    return DUMP_SUCCESS;
+}
+
+DumpReturn PlayerDumpReader::LoadTextDump(FILE* fin, uint32 account, std::string name, uint32 guid, uint32& itemCount, uint32& mailCount)
+{
+    QueryResult* result;
+    char newguid[20], chraccount[20], newpetid[20], currpetid[20], lastpetid[20];
+
     snprintf(newguid, 20, "%u", guid);
     snprintf(chraccount, 20, "%u", account);
     snprintf(newpetid, 20, "%u", sObjectMgr.GeneratePetNumber());
@@ -855,16 +1248,289 @@ DumpReturn PlayerDumpReader::LoadDump(const std::string& file, uint32 account, s
 
     CharacterDatabase.CommitTransaction();
 
-    // FIXME: current code with post-updating guids not safe for future per-map threads
-    sObjectMgr.m_ItemGuids.Set(sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed() + items.size());
-    sObjectMgr.m_MailIds.Set(sObjectMgr.m_MailIds.GetNextAfterMaxUsed() +  mails.size());
+    itemCount = items.size();
+    mailCount = mails.size();
+    return DUMP_SUCCESS;
+}
 
-    if (incHighest)
+struct DumpValue
+{
+    std::string value;
+    bool isNull;
+
+    void Set(std::string const& newValue)
     {
-        sObjectMgr.m_CharGuids.Set(sObjectMgr.m_CharGuids.GetNextAfterMaxUsed() + 1);
+        value = newValue;
+        isNull = false;
     }
+};
 
-    fclose(fin);
+/// Multi-row INSERT of the rows of one table of a binary dump.
+class DumpInsertBatch
+{
+    public:
+        DumpInsertBatch(std::string const& table, std::vector<std::string> const& columns) : m_rows(0)
+        {
+            m_prefix = "INSERT INTO `" + table + "` (";
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                m_prefix += (i ? ",`" : "`") + columns[i] + "`";
+            }
+            m_prefix += ") VALUES ";
+        }
+
+        bool AddRow(std::vector<DumpValue>& row)
+        {
+            m_query += m_rows ? ",(" : m_prefix + "(";
+            for (size_t i = 0; i < row.size(); ++i)
+            {
+                if (i)
+                {
+                    m_query += ",";
+                }
+
+                if (row[i].isNull)
+                {
+                    m_query += "NULL";
+                    continue;
+                }
+
+                CharacterDatabase.escape_string(row[i].value);
+                m_query += "'" + row[i].value + "'";
+            }
+            m_query += ")";
+
+            return ++m_rows < PLAYER_DUMP_INSERT_ROWS || Flush();
+        }
+
+        bool Flush()
+        {
+            if (!m_rows)
+            {
+                return true;
+            }
+
+            bool done = CharacterDatabase.Execute(m_query.c_str());
+            m_query.clear();
+            m_rows = 0;
+            return done;
+        }
+
+    private:
+        std::string m_prefix;
+        std::string m_query;
+        uint32 m_rows;
+};
+
+DumpReturn PlayerDumpReader::LoadBinaryDump(PlayerDumpFile& in, uint32 account, std::string name, uint32 guid, uint32& itemCount, uint32& mailCount)
+{
+    uint32 version;
+    std::string dbversionInDumpFile;
+    if (!in.ReadUInt32(version) || !in.ReadString(dbversionInDumpFile))
+    {
+        return DUMP_UNEXPECTED_END;
+    }
+
+    if (version != PLAYER_DUMP_FORMAT_VERSION)
+    {
+        sLog.outError("LoadPlayerDump: Cannot load player dump - binary format version is %u, supported is %u", version, PLAYER_DUMP_FORMAT_VERSION);
+        return DUMP_FILE_BROKEN;
+    }
+
+    std::string dbversion = GetCharacterDbVersion();
+    if (dbversionInDumpFile != dbversion)
+    {
+        sLog.outError("LoadPlayerDump: Cannot load player dump - file version is %s, DB needs %s", dbversionInDumpFile.c_str(), dbversion.c_str());
+        return DUMP_DB_VERSION_MISMATCH;
+    }
+
+    std::string newguid = std::to_string(guid);
+    std::string chraccount = std::to_string(account);
+    uint32 itemHiGuid = sObjectMgr.m_ItemGuids.GetNextAfterMaxUsed();
+    uint32 mailHiId = sObjectMgr.m_MailIds.GetNextAfterMaxUsed();
+
+    // old -> new guid lookup tables
+    std::map<uint32, uint32> items;
+    std::map<uint32, uint32> mails;
+    std::map<uint32, uint32> pets;
+
+    typedef std::vector<std::pair<uint32, DumpColumnRemap> > ColumnRemaps;  // column index, change
+    ColumnRemaps remaps;
+    std::string tableName;
+    std::vector<std::string> columns;
+    std::vector<DumpValue> row;
+
+    CharacterDatabase.BeginTransaction();
+
+    uint8 block;
+    while (in.ReadUInt8(block) && block == DUMP_BLOCK_TABLE)
+    {
+        uint32 columnCount;
+        if (!in.ReadString(tableName) || !in.ReadUInt32(columnCount) || !columnCount || columnCount > MAX_QUERY_LEN)
+        {
+            ROLLBACK(DUMP_FILE_BROKEN);
+        }
+
+        DumpTable const* dTable = FindDumpTable(tableName);
+        if (!dTable)
+        {
+            sLog.outError("LoadPlayerDump: Unknown table: '%s'!", tableName.c_str());
+            ROLLBACK(DUMP_FILE_BROKEN);
+        }
+
+        columns.resize(columnCount);
+        for (uint32 i = 0; i < columnCount; ++i)
+        {
+            if (!in.ReadString(columns[i]) || columns[i].find('`') != std::string::npos)
+            {
+                ROLLBACK(DUMP_FILE_BROKEN);
+            }
+        }
+
+        // the columns to change are found by name, not by position
+        remaps.clear();
+        for (size_t i = 0; i < sizeof(dumpColumnRemaps) / sizeof(dumpColumnRemaps[0]); ++i)
+        {
+            if (dumpColumnRemaps[i].type != dTable->type)
+            {
+                continue;
+            }
+
+            std::vector<std::string>::const_iterator column = std::find(columns.begin(), columns.end(), dumpColumnRemaps[i].column);
+            if (column == columns.end())
+            {
+                sLog.outError("LoadPlayerDump: Table '%s' has no column '%s'!", tableName.c_str(), dumpColumnRemaps[i].column);
+                ROLLBACK(DUMP_FILE_BROKEN);
+            }
+
+            remaps.push_back(std::make_pair(uint32(column - columns.begin()), dumpColumnRemaps[i].remap));
+        }
+
+        uint32 atLoginColumn = std::find(columns.begin(), columns.end(), "at_login") - columns.begin();
+
+        DumpInsertBatch batch(tableName, columns);
+        row.resize(columnCount);
+        while (in.ReadUInt8(block) && block == DUMP_BLOCK_ROW)
+        {
+            for (uint32 i = 0; i < columnCount; ++i)
+            {
+                if (!in.ReadValue(row[i].value, row[i].isNull))
+                {
+                    ROLLBACK(DUMP_UNEXPECTED_END);
+                }
+            }
+
+            // change the data to server values
+            for (ColumnRemaps::const_iterator itr = remaps.begin(); itr != remaps.end(); ++itr)
+            {
+                DumpValue& value = row[itr->first];
+                switch (itr->second)
+                {
+                    case DUMP_REMAP_CHARACTER:
+                        value.Set(newguid);
+                        break;
+                    case DUMP_REMAP_ACCOUNT:
+                        value.Set(chraccount);
+                        break;
+                    case DUMP_REMAP_NAME:
+                    {
+                        if (!name.empty())
+                        {
+                            value.Set(name);
+                            break;
+                        }
+
+                        // keep the original name, a taken one is renamed on login
+                        std::string safeName = value.value;
+                        CharacterDatabase.escape_string(safeName);
+                        if (QueryResult* result = CharacterDatabase.PQuery("SELECT * FROM `characters` WHERE `name` = '%s'", safeName.c_str()))
+                        {
+                            delete result;
+
+                            if (atLoginColumn >= columnCount)
+                            {
+                                ROLLBACK(DUMP_FILE_BROKEN);
+                            }
+                            row[atLoginColumn].Set("1");
+                        }
+                        break;
+                    }
+                    case DUMP_REMAP_ITEM_NONZERO:
+                        if (value.isNull || value.value == "0")
+                        {
+                            break;
+                        }
+                        // no break
+                    case DUMP_REMAP_ITEM:
+                        value.Set(std::to_string(registerNewGuid(atoi(value.value.c_str()), items, itemHiGuid)));
+                        break;
+                    case DUMP_REMAP_ITEM_DATA:
+                    {
+                        Tokens tokens = StrSplit(value.value, " ");
+                        if (tokens.size() <= ITEM_FIELD_OWNER)
+                        {
+                            ROLLBACK(DUMP_FILE_BROKEN);
+                        }
+
+                        tokens[OBJECT_FIELD_GUID] = std::to_string(registerNewGuid(atoi(tokens[OBJECT_FIELD_GUID].c_str()), items, itemHiGuid));
+                        tokens[ITEM_FIELD_OWNER] = newguid;
+
+                        std::ostringstream ss;
+                        for (Tokens::const_iterator token = tokens.begin(); token != tokens.end(); ++token)
+                        {
+                            ss << *token << " ";
+                        }
+                        value.Set(ss.str());
+                        break;
+                    }
+                    case DUMP_REMAP_MAIL:
+                        value.Set(std::to_string(registerNewGuid(atoi(value.value.c_str()), mails, mailHiId)));
+                        break;
+                    case DUMP_REMAP_NEW_PET:
+                    {
+                        uint32 oldPetId = atoi(value.value.c_str());
+                        std::map<uint32, uint32>::const_iterator pet = pets.find(oldPetId);
+                        if (pet == pets.end())
+                        {
+                            pet = pets.insert(std::make_pair(oldPetId, sObjectMgr.GeneratePetNumber())).first;
+                        }
+                        value.Set(std::to_string(pet->second));
+                        break;
+                    }
+                    case DUMP_REMAP_PET:
+                    {
+                        // character_pet comes first in the dump
+                        std::map<uint32, uint32>::const_iterator pet = pets.find(atoi(value.value.c_str()));
+                        if (pet == pets.end())
+                        {
+                            ROLLBACK(DUMP_FILE_BROKEN);
+                        }
+                        value.Set(std::to_string(pet->second));
+                        break;
+                    }
+                }
+            }
+
+            if (!batch.AddRow(row))
+            {
+                ROLLBACK(DUMP_FILE_BROKEN);
+            }
+        }
+
+        if (block != DUMP_BLOCK_TABLE_END || !batch.Flush())
+        {
+            ROLLBACK(DUMP_FILE_BROKEN);
+        }
+    }
+
+    if (block != DUMP_BLOCK_END)
+    {
+        ROLLBACK(DUMP_UNEXPECTED_END);
+    }
+
+    CharacterDatabase.CommitTransaction();
 
+    itemCount = items.size();
+    mailCount = mails.size();
     return DUMP_SUCCESS;
 }
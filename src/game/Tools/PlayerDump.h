@@ -26,6 +26,10 @@
 #define MANGOS_H_PLAYER_DUMP
 
 #include <set>
+#include <vector>
+
+class Field;
+class PlayerDumpFile;
 
 enum DumpTableType
 {
@@ -71,17 +75,51 @@ class PlayerDump
         PlayerDump() {}
 };
 
+/**
+ * @brief Writes the rows of a character as SQL text or as a binary dump file.
+ *
+ * The binary dump is streamed to the file table by table as the rows are
+ * fetched. It starts with magic bytes, a format version and
+ * the character DB version, then holds per table its name, column names and
+ * rows of length prefixed values.
+ */
 class PlayerDumpWriter : public PlayerDump
 {
     public:
+        /// Low guid and file name of a character dump.
+        typedef std::vector<std::pair<uint32, std::string> > DumpFileList;
+
         PlayerDumpWriter() {}
 
+        /// SQL text of the character, as kept by the character deletion log.
         std::string GetDump(uint32 guid);
+        /// Writes the binary dump of the character.
         DumpReturn WriteDump(const std::string& file, uint32 guid);
+
+        /**
+         * @brief Writes the binary dumps of many characters on a background thread, e.g. for realm merges.
+         *
+         * Progress and the final count go to the server log. The dump queries
+         * share the character DB query connections with the world thread, so
+         * no more threads are used than CharacterDatabaseConnections: with the
+         * default of 1 the dumps are written one after another.
+         *
+         * @param threads number of dumps written in parallel
+         * @returns false if an earlier job is still running
+         */
+        static bool StartDumps(DumpFileList const& dumps, uint32 threads);
+        /// Waits for a running StartDumps() job, must be called before the character DB is closed.
+        static void WaitDumps();
     private:
+        /// Writes the dumps on @p threads threads and returns the number that failed.
+        static uint32 WriteDumps(DumpFileList const& dumps, uint32 threads);
+
         typedef std::set<uint32> GUIDs;
 
+        char const* GetKeyField(DumpTableType type, GUIDs const*& guids) const;
+        void StoreGUIDs(DumpTableType type, Field* fields);
         void DumpTableContent(std::string& dump, uint32 guid, char const* tableFrom, char const* tableTo, DumpTableType type);
+        void WriteTableContent(PlayerDumpFile& out, uint32 guid, char const* table, DumpTableType type);
         std::string GenerateWhereStr(char const* field, GUIDs const& guids, GUIDs::const_iterator& itr);
         std::string GenerateWhereStr(char const* field, uint32 guid);
 
@@ -95,7 +133,12 @@ class PlayerDumpReader : public PlayerDump
     public:
         PlayerDumpReader() {}
 
+        /// Loads a binary dump, or a SQL text dump of older versions.
         DumpReturn LoadDump(const std::string& file, uint32 account, std::string name, uint32 guid);
+
+    private:
+        DumpReturn LoadTextDump(FILE* fin, uint32 account, std::string name, uint32 guid, uint32& itemCount, uint32& mailCount);
+        DumpReturn LoadBinaryDump(PlayerDumpFile& in, uint32 account, std::string name, uint32 guid, uint32& itemCount, uint32& mailCount);
 };
 
 #endif
@@ -285,6 +285,7 @@ class ChatHandler
         bool HandleDebugGetItemValueCommand(char* args);
         bool HandleDebugGetLootRecipientCommand(char* args);
         bool HandleDebugGetValueCommand(char* args);
+        bool HandleDebugLootSimCommand(char* args);
         bool HandleDebugModItemValueCommand(char* args);
         bool HandleDebugModValueCommand(char* args);
         bool HandleDebugSetAuraStateCommand(char* args);
@@ -315,6 +316,7 @@ class ChatHandler
         bool HandleEventStartCommand(char* args);
         bool HandleEventStopCommand(char* args);
         bool HandleEventInfoCommand(char* args);
+        bool HandleEventProgressCommand(char* args);
 
         bool HandleGameObjectAddCommand(char* args);
         bool HandleGameObjectAnimationCommand(char* args);
@@ -452,6 +454,7 @@ class ChatHandler
 
         bool HandlePDumpLoadCommand(char* args);
         bool HandlePDumpWriteCommand(char* args);
+        bool HandlePDumpWriteAllCommand(char* args);
 
         bool HandlePoolListCommand(char* args);
         bool HandlePoolSpawnsCommand(char* args);
@@ -581,6 +584,7 @@ class ChatHandler
         bool HandleServerLogFilterCommand(char* args);
         bool HandleServerLogLevelCommand(char* args);
         bool HandleServerMotdCommand(char* args);
+        bool HandleServerPerfCommand(char* args);
         bool HandleServerPLimitCommand(char* args);
         bool HandleServerResetAllRaidCommand(char* args);
         bool HandleServerRestartCommand(char* args);
@@ -631,6 +631,8 @@ uint32 GameEventMgr::Initialize()                           // return the next e
     }
 
     uint32 delay = Update(&activeAtShutdown);
+    // at startup nothing is visible yet, no need to spread the spawns
+    UpdateSteps(true);
     BASIC_LOG("Game Event system initialized.");
     m_IsGameEventsInit = true;
     return delay;
@@ -706,6 +708,7 @@ void GameEventMgr::UnApplyEvent(uint16 event_id)
     GameEventSpawn(event_nid);
     // restore equipment or model
     UpdateCreatureData(event_id, false);
+    SetProgressDirection(event_id, false);
     // Remove quests that are events only to non event npc
     UpdateEventQuests(event_id, false);
     SendEventMails(event_nid);
@@ -722,13 +725,14 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id, bool resume)
     }
 
     sLog.outString("GameEvent %u \"%s\" started.", event_id, mGameEvent[event_id].description.c_str());
-    // spawn positive event tagget objects
-    GameEventSpawn(event_id);
-    // un-spawn negative event tagged objects
+    // un-spawn negative event tagged objects first, so they are never seen together with their replacements
     int16 event_nid = (-1) * event_id;
     GameEventUnspawn(event_nid);
+    // spawn positive event tagget objects
+    GameEventSpawn(event_id);
     // Change equipement or model
     UpdateCreatureData(event_id, true);
+    SetProgressDirection(event_id, true);
     // Add quests that are events only to non event npc
     UpdateEventQuests(event_id, true);
 
@@ -742,6 +746,7 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id, bool resume)
 void GameEventMgr::GameEventSpawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
+    uint16 progress_id = event_id < 0 ? uint16(-event_id) : uint16(event_id);
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventCreatureGuids.size())
     {
@@ -751,26 +756,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
-        // Add to correct cell
-        CreatureData const* data = sObjectMgr.GetCreatureData(*itr);
-        if (data)
-        {
-            // negative event id for pool element meaning allow be used in next pool spawn
-            if (event_id < 0)
-            {
-                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<Creature>(*itr))
-                {
-                    // will have chance at next pool update
-                    sPoolMgr.SetExcludeObject<Creature>(pool_id, *itr, false);
-                    sPoolMgr.UpdatePoolInMaps<Creature>(pool_id);
-                    continue;
-                }
-            }
-
-            sObjectMgr.AddCreatureToGrid(*itr, data);
-
-            Creature::SpawnInMaps(*itr, data);
-        }
+        QueueStep(GameEventStep(GAME_EVENT_STEP_SPAWN_CREATURE, progress_id, event_id, *itr));
     }
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventGameobjectGuids.size())
@@ -781,26 +767,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
     {
-        // Add to correct cell
-        GameObjectData const* data = sObjectMgr.GetGOData(*itr);
-        if (data)
-        {
-            // negative event id for pool element meaning allow be used in next pool spawn
-            if (event_id < 0)
-            {
-                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<GameObject>(*itr))
-                {
-                    // will have chance at next pool update
-                    sPoolMgr.SetExcludeObject<GameObject>(pool_id, *itr, false);
-                    sPoolMgr.UpdatePoolInMaps<GameObject>(pool_id);
-                    continue;
-                }
-            }
-
-            sObjectMgr.AddGameobjectToGrid(*itr, data);
-
-            GameObject::SpawnInMaps(*itr, data);
-        }
+        QueueStep(GameEventStep(GAME_EVENT_STEP_SPAWN_GAMEOBJECT, progress_id, event_id, *itr));
     }
 
     if (event_id > 0)
@@ -813,7 +780,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 
         for (IdList::iterator itr = mGameEventSpawnPoolIds[event_id].begin(); itr != mGameEventSpawnPoolIds[event_id].end(); ++itr)
         {
-            sPoolMgr.SpawnPoolInMaps(*itr, true);
+            QueueStep(GameEventStep(GAME_EVENT_STEP_SPAWN_POOL, progress_id, event_id, *itr));
         }
     }
 }
@@ -821,6 +788,7 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
 void GameEventMgr::GameEventUnspawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
+    uint16 progress_id = event_id < 0 ? uint16(-event_id) : uint16(event_id);
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventCreatureGuids.size())
     {
@@ -830,26 +798,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
-        // Remove the creature from grid
-        if (CreatureData const* data = sObjectMgr.GetCreatureData(*itr))
-        {
-            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
-            if (event_id < 0)
-            {
-                if (uint16 poolid = sPoolMgr.IsPartOfAPool<Creature>(*itr))
-                {
-                    sPoolMgr.SetExcludeObject<Creature>(poolid, *itr, true);
-                    sPoolMgr.UpdatePoolInMaps<Creature>(poolid, *itr);
-                    continue;
-                }
-            }
-
-            // Remove spawn data
-            sObjectMgr.RemoveCreatureFromGrid(*itr, data);
-
-            // Remove spawned cases
-            Creature::AddToRemoveListInMaps(*itr, data);
-        }
+        QueueStep(GameEventStep(GAME_EVENT_STEP_UNSPAWN_CREATURE, progress_id, event_id, *itr));
     }
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventGameobjectGuids.size())
@@ -860,26 +809,7 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
     {
-        // Remove the gameobject from grid
-        if (GameObjectData const* data = sObjectMgr.GetGOData(*itr))
-        {
-            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
-            if (event_id < 0)
-            {
-                if (uint16 poolid = sPoolMgr.IsPartOfAPool<GameObject>(*itr))
-                {
-                    sPoolMgr.SetExcludeObject<GameObject>(poolid, *itr, true);
-                    sPoolMgr.UpdatePoolInMaps<GameObject>(poolid, *itr);
-                    continue;
-                }
-            }
-
-            // Remove spawn data
-            sObjectMgr.RemoveGameobjectFromGrid(*itr, data);
-
-            // Remove spawned cases
-            GameObject::AddToRemoveListInMaps(*itr, data);
-        }
+        QueueStep(GameEventStep(GAME_EVENT_STEP_UNSPAWN_GAMEOBJECT, progress_id, event_id, *itr));
     }
 
     if (event_id > 0)
@@ -892,9 +822,115 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
         for (IdList::iterator itr = mGameEventSpawnPoolIds[event_id].begin(); itr != mGameEventSpawnPoolIds[event_id].end(); ++itr)
         {
-            sPoolMgr.DespawnPoolInMaps(*itr);
+            QueueStep(GameEventStep(GAME_EVENT_STEP_UNSPAWN_POOL, progress_id, event_id, *itr));
+        }
+    }
+}
+
+void GameEventMgr::SpawnCreature(int16 event_id, uint32 guid)
+{
+    // Add to correct cell
+    CreatureData const* data = sObjectMgr.GetCreatureData(guid);
+    if (!data)
+    {
+        return;
+    }
+
+    // negative event id for pool element meaning allow be used in next pool spawn
+    if (event_id < 0)
+    {
+        if (uint16 pool_id = sPoolMgr.IsPartOfAPool<Creature>(guid))
+        {
+            // will have chance at next pool update
+            sPoolMgr.SetExcludeObject<Creature>(pool_id, guid, false);
+            sPoolMgr.UpdatePoolInMaps<Creature>(pool_id);
+            return;
+        }
+    }
+
+    sObjectMgr.AddCreatureToGrid(guid, data);
+
+    Creature::SpawnInMaps(guid, data);
+}
+
+void GameEventMgr::SpawnGameObject(int16 event_id, uint32 guid)
+{
+    // Add to correct cell
+    GameObjectData const* data = sObjectMgr.GetGOData(guid);
+    if (!data)
+    {
+        return;
+    }
+
+    // negative event id for pool element meaning allow be used in next pool spawn
+    if (event_id < 0)
+    {
+        if (uint16 pool_id = sPoolMgr.IsPartOfAPool<GameObject>(guid))
+        {
+            // will have chance at next pool update
+            sPoolMgr.SetExcludeObject<GameObject>(pool_id, guid, false);
+            sPoolMgr.UpdatePoolInMaps<GameObject>(pool_id);
+            return;
+        }
+    }
+
+    sObjectMgr.AddGameobjectToGrid(guid, data);
+
+    GameObject::SpawnInMaps(guid, data);
+}
+
+void GameEventMgr::UnspawnCreature(int16 event_id, uint32 guid)
+{
+    // Remove the creature from grid
+    CreatureData const* data = sObjectMgr.GetCreatureData(guid);
+    if (!data)
+    {
+        return;
+    }
+
+    // negative event id for pool element meaning unspawn in pool and exclude for next spawns
+    if (event_id < 0)
+    {
+        if (uint16 poolid = sPoolMgr.IsPartOfAPool<Creature>(guid))
+        {
+            sPoolMgr.SetExcludeObject<Creature>(poolid, guid, true);
+            sPoolMgr.UpdatePoolInMaps<Creature>(poolid, guid);
+            return;
         }
     }
+
+    // Remove spawn data
+    sObjectMgr.RemoveCreatureFromGrid(guid, data);
+
+    // Remove spawned cases
+    Creature::AddToRemoveListInMaps(guid, data);
+}
+
+void GameEventMgr::UnspawnGameObject(int16 event_id, uint32 guid)
+{
+    // Remove the gameobject from grid
+    GameObjectData const* data = sObjectMgr.GetGOData(guid);
+    if (!data)
+    {
+        return;
+    }
+
+    // negative event id for pool element meaning unspawn in pool and exclude for next spawns
+    if (event_id < 0)
+    {
+        if (uint16 poolid = sPoolMgr.IsPartOfAPool<GameObject>(guid))
+        {
+            sPoolMgr.SetExcludeObject<GameObject>(poolid, guid, true);
+            sPoolMgr.UpdatePoolInMaps<GameObject>(poolid, guid);
+            return;
+        }
+    }
+
+    // Remove spawn data
+    sObjectMgr.RemoveGameobjectFromGrid(guid, data);
+
+    // Remove spawned cases
+    GameObject::AddToRemoveListInMaps(guid, data);
 }
 
 GameEventCreatureData const* GameEventMgr::GetCreatureUpdateDataForActiveEvent(uint32 lowguid) const
@@ -954,17 +990,104 @@ void GameEventMgr::UpdateCreatureData(int16 event_id, bool activate)
 {
     for (GameEventCreatureDataList::iterator itr = mGameEventCreatureData[event_id].begin(); itr != mGameEventCreatureData[event_id].end(); ++itr)
     {
-        // Remove the creature from grid
-        CreatureData const* data = sObjectMgr.GetCreatureData(itr->first);
-        if (!data)
+        QueueStep(GameEventStep(GAME_EVENT_STEP_CREATURE_DATA, uint16(event_id), activate ? event_id : int16(-event_id), itr->first, &itr->second));
+    }
+}
+
+void GameEventMgr::QueueStep(GameEventStep const& step)
+{
+    GameEventProgress& progress = m_progress[step.event];
+    if (!progress.total)
+    {
+        progress.startTime = getMSTime();
+    }
+
+    ++progress.total;
+    m_steps.push_back(step);
+}
+
+void GameEventMgr::SetProgressDirection(uint16 event_id, bool activate)
+{
+    ProgressMap::iterator itr = m_progress.find(event_id);
+    if (itr != m_progress.end())
+    {
+        itr->second.activate = activate;
+    }
+}
+
+void GameEventMgr::DoStep(GameEventStep const& step)
+{
+    switch (step.type)
+    {
+        case GAME_EVENT_STEP_UNSPAWN_CREATURE:
+            UnspawnCreature(step.spawnEvent, step.id);
+            break;
+        case GAME_EVENT_STEP_UNSPAWN_GAMEOBJECT:
+            UnspawnGameObject(step.spawnEvent, step.id);
+            break;
+        case GAME_EVENT_STEP_UNSPAWN_POOL:
+            sPoolMgr.DespawnPoolInMaps(step.id);
+            break;
+        case GAME_EVENT_STEP_SPAWN_CREATURE:
+            SpawnCreature(step.spawnEvent, step.id);
+            break;
+        case GAME_EVENT_STEP_SPAWN_GAMEOBJECT:
+            SpawnGameObject(step.spawnEvent, step.id);
+            break;
+        case GAME_EVENT_STEP_SPAWN_POOL:
+            sPoolMgr.SpawnPoolInMaps(step.id, true);
+            break;
+        case GAME_EVENT_STEP_CREATURE_DATA:
         {
-            continue;
+            CreatureData const* data = sObjectMgr.GetCreatureData(step.id);
+            if (!data)
+            {
+                break;
+            }
+
+            // Update if spawned
+            GameEventUpdateCreatureDataInMapsWorker worker(data->GetObjectGuid(step.id), data, step.creatureData, step.spawnEvent > 0);
+            sMapMgr.DoForAllMapsWithMapId(data->mapid, worker);
+            break;
         }
+    }
+}
 
-        // Update if spawned
-        GameEventUpdateCreatureDataInMapsWorker worker(data->GetObjectGuid(itr->first), data, &itr->second, activate);
-        sMapMgr.DoForAllMapsWithMapId(data->mapid, worker);
+void GameEventMgr::UpdateSteps(bool all /*= false*/)
+{
+    if (m_steps.empty())
+    {
+        return;
+    }
+
+    uint32 budget = all ? 0 : sWorld.getConfig(CONFIG_UINT32_GAME_EVENT_UPDATE_BUDGET);
+    uint32 startTime = getMSTime();
+
+    for (ProgressMap::iterator itr = m_progress.begin(); itr != m_progress.end(); ++itr)
+    {
+        ++itr->second.ticks;
+    }
+
+    // at least one step per tick, whatever the budget
+    do
+    {
+        GameEventStep step = m_steps.front();
+        m_steps.pop_front();
+
+        DoStep(step);
+
+        ProgressMap::iterator itr = m_progress.find(step.event);
+        if (itr != m_progress.end() && ++itr->second.done >= itr->second.total)
+        {
+            if (m_IsGameEventsInit)
+            {
+                sLog.outString("GameEvent %u \"%s\" %s: %u spawn steps done in %u ms over %u ticks.", step.event, mGameEvent[step.event].description.c_str(),
+                               itr->second.activate ? "started" : "stopped", itr->second.total, getMSTimeDiff(itr->second.startTime, getMSTime()), itr->second.ticks);
+            }
+            m_progress.erase(itr);
+        }
     }
+    while (!m_steps.empty() && (!budget || getMSTimeDiff(startTime, getMSTime()) < budget));
 }
 
 void GameEventMgr::UpdateEventQuests(uint16 event_id, bool Activate)
@@ -29,6 +29,8 @@
 #include "SharedDefines.h"
 #include "Platform/Define.h"
 
+#include <deque>
+
 #define max_ge_check_delay 86400                            // 1 day in seconds
 
 class Creature;
@@ -71,6 +73,46 @@ struct GameEventMail
 
 typedef std::pair<uint32, GameEventCreatureData> GameEventCreatureDataPair;
 
+enum GameEventStepType
+{
+    GAME_EVENT_STEP_UNSPAWN_CREATURE,
+    GAME_EVENT_STEP_UNSPAWN_GAMEOBJECT,
+    GAME_EVENT_STEP_UNSPAWN_POOL,
+    GAME_EVENT_STEP_SPAWN_CREATURE,
+    GAME_EVENT_STEP_SPAWN_GAMEOBJECT,
+    GAME_EVENT_STEP_SPAWN_POOL,
+    GAME_EVENT_STEP_CREATURE_DATA
+};
+
+/**
+ * @brief One spawn, despawn or creature data change of a game event start or stop.
+ */
+struct GameEventStep
+{
+    GameEventStep(GameEventStepType _type, uint16 _event, int16 _spawnEvent, uint32 _id, GameEventCreatureData* _creatureData = NULL)
+        : type(_type), event(_event), spawnEvent(_spawnEvent), id(_id), creatureData(_creatureData) {}
+
+    GameEventStepType type;
+    uint16 event;                                           // event whose start or stop queued the step
+    int16 spawnEvent;                                       // spawn list of the step, negative for the objects the event replaces
+    uint32 id;                                              // creature/gameobject guid or pool id
+    GameEventCreatureData* creatureData;                    // GAME_EVENT_STEP_CREATURE_DATA only, applied if spawnEvent > 0
+};
+
+/**
+ * @brief Queued and done steps of an event start or stop, for the GM progress report.
+ */
+struct GameEventProgress
+{
+    GameEventProgress() : total(0), done(0), activate(false), startTime(0), ticks(0) {}
+
+    uint32 total;
+    uint32 done;
+    bool activate;                                          // last queued transition was a start
+    uint32 startTime;                                       // getMSTime() when the steps were queued
+    uint32 ticks;                                           // ticks that processed steps
+};
+
 class GameEventMgr
 {
     public:
@@ -95,6 +137,19 @@ class GameEventMgr
         int16 GetGameEventId(uint32 guid_or_poolid);
 
         GameEventCreatureData const* GetCreatureUpdateDataForActiveEvent(uint32 lowguid) const;
+
+        typedef std::map<uint16, GameEventProgress> ProgressMap;
+
+        /**
+         * @brief Runs queued spawn steps until the Event.UpdateBudget of the tick is used up.
+         *
+         * Called each world tick. The steps of an event start or stop run in
+         * the order they were queued: despawns of the replaced objects first,
+         * then the spawns and the creature data changes.
+         */
+        void UpdateSteps(bool all = false);
+        ProgressMap const& GetProgress() const { return m_progress; }
+        uint32 GetPendingStepCount() const { return m_steps.size(); }
     private:
         void ApplyNewEvent(uint16 event_id, bool resume);
         void UnApplyEvent(uint16 event_id);
@@ -103,6 +158,13 @@ class GameEventMgr
         void UpdateCreatureData(int16 event_id, bool activate);
         void UpdateEventQuests(uint16 event_id, bool activate);
         void SendEventMails(int16 event_id);
+        void QueueStep(GameEventStep const& step);
+        void SetProgressDirection(uint16 event_id, bool activate);
+        void DoStep(GameEventStep const& step);
+        void SpawnCreature(int16 event_id, uint32 guid);
+        void SpawnGameObject(int16 event_id, uint32 guid);
+        void UnspawnCreature(int16 event_id, uint32 guid);
+        void UnspawnGameObject(int16 event_id, uint32 guid);
        // To implement for GameObjectAI - see code in CMangos
        // void OnEventHappened(uint16 event_id, bool activate, bool resume);
        // void ComputeEventStartAndEndTime(GameEventData& data);
@@ -134,6 +196,9 @@ class GameEventMgr
         GameEventDataMap  mGameEvent;
         ActiveEvents m_ActiveEvents;
         bool m_IsGameEventsInit;
+
+        std::deque<GameEventStep> m_steps;                  // queued by StartEvent/StopEvent, run by UpdateSteps()
+        ProgressMap m_progress;                             // events with queued steps
 };
 
 #define sGameEventMgr MaNGOS::Singleton<GameEventMgr>::Instance()
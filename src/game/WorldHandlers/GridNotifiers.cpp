@@ -31,6 +31,7 @@
 #include "ObjectAccessor.h"
 #include "BattleGround/BattleGroundMgr.h"
 #include "CreatureAI.h"
+#include "World.h"
 
 using namespace MaNGOS;
 
@@ -187,16 +188,55 @@ void ObjectMessageDistDeliverer::Visit(CameraMapType& m)
     }
 }
 
+ObjectUpdater::ObjectUpdater(const uint32& diff, uint32 tick) : i_timeDiff(diff), i_tick(tick), i_now(GameTime::GetGameTime()), i_tier(UPDATE_LOD_NEAR)
+{
+    i_intervals[UPDATE_LOD_NEAR] = 1;
+    i_intervals[UPDATE_LOD_MID] = sWorld.getConfig(CONFIG_UINT32_UPDATE_LOD_MID_INTERVAL);
+    i_intervals[UPDATE_LOD_FAR] = sWorld.getConfig(CONFIG_UINT32_UPDATE_LOD_FAR_INTERVAL);
+
+    for (uint32 i = 0; i < MAX_UPDATE_LOD_TIERS; ++i)
+    {
+        i_objects[i] = 0;
+        i_updates[i] = 0;
+    }
+}
+
 template<class T>
 void ObjectUpdater::Visit(GridRefManager<T>& m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        WorldObject::UpdateHelper helper(iter->getSource());
-        helper.Update(i_timeDiff);
+        UpdateObject(iter->getSource(), i_tier == UPDATE_LOD_NEAR || IsFullRate(iter->getSource()));
     }
 }
 
+void ObjectUpdater::UpdateObject(WorldObject* obj, bool fullRate)
+{
+    ++i_objects[i_tier];
+
+    // nothing to do until its wake time, no time to pass on either
+    if (obj->IsSleeping(i_now))
+    {
+        return;
+    }
+
+    WorldObject::UpdateHelper helper(obj);
+    if (!fullRate && (i_tick + obj->GetGUIDLow()) % i_intervals[i_tier] != 0)
+    {
+        helper.Skip(i_timeDiff);
+        return;
+    }
+
+    ++i_updates[i_tier];
+    helper.Update(i_timeDiff);
+}
+
+bool ObjectUpdater::IsFullRate(Creature* creature)
+{
+    return creature->IsInCombat() || creature->IsInEvadeMode() || creature->IsActiveObject() ||
+           !creature->GetCharmerOrOwnerGuid().IsEmpty();
+}
+
 bool CannibalizeObjectCheck::operator()(Corpse* u)
 {
     // ignore bones
@@ -34,6 +34,16 @@
 #include "Player.h"
 #include "Unit.h"
 
+/// Update rate tiers of Map::Update, from the distance of a cell to the nearest player or active object
+enum UpdateLODTier
+{
+    UPDATE_LOD_NEAR     = 0,                                // every tick
+    UPDATE_LOD_MID      = 1,                                // every UpdateLOD.MidInterval ticks
+    UPDATE_LOD_FAR      = 2,                                // every UpdateLOD.FarInterval ticks
+};
+
+#define MAX_UPDATE_LOD_TIERS 3
+
 namespace MaNGOS
 {
     struct VisibleNotifier
@@ -112,15 +122,35 @@ namespace MaNGOS
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
     };
 
+    /**
+     * @brief Updates the creatures and objects of the active cells, at the rate of the cell's UpdateLODTier.
+     *
+     * Objects of the slower tiers are spread over the ticks by guid, an object
+     * left out passes its time on to its next update. Objects in combat, owned
+     * or charmed by someone, active objects and dynamic objects always update.
+     * Sleeping objects (see WorldObject::SleepUntil()) are not updated at all.
+     */
     struct ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32& diff) : i_timeDiff(diff) {}
+        uint32 i_tick;
+        time_t i_now;
+        UpdateLODTier i_tier;                               // tier of the visited cell
+        uint32 i_intervals[MAX_UPDATE_LOD_TIERS];
+        uint32 i_objects[MAX_UPDATE_LOD_TIERS];             // objects seen per tier, for the profiler
+        uint32 i_updates[MAX_UPDATE_LOD_TIERS];             // objects updated per tier
+
+        ObjectUpdater(const uint32& diff, uint32 tick);
         template<class T> void Visit(GridRefManager<T>& m);
         void Visit(PlayerMapType&) {}
         void Visit(CorpseMapType&) {}
         void Visit(CameraMapType&) {}
         void Visit(CreatureMapType&);
+
+        void UpdateObject(WorldObject* obj, bool fullRate);
+        static bool IsFullRate(Creature* creature);
+        static bool IsFullRate(GameObject* go) { return go->IsActiveObject() || !go->GetOwnerGuid().IsEmpty(); }
+        static bool IsFullRate(DynamicObject* /*dynObj*/) { return true; }
     };
 
     struct PlayerRelocationNotifier
@@ -378,13 +408,13 @@ namespace MaNGOS
     };
 
     // All accepted by Check units if any
-    template<class Check>
+    template<class Check, class Container = std::list<Unit*> >
     struct UnitListSearcher
     {
-        std::list<Unit*>& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        UnitListSearcher(std::list<Unit*>& objects, Check& check) : i_objects(objects), i_check(check) {}
+        UnitListSearcher(Container& objects, Check& check) : i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
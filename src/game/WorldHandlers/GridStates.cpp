@@ -25,6 +25,7 @@
 #include "GridStates.h"
 #include "ObjectGridLoader.h"
 #include "Log.h"
+#include "World.h"
 
 GridState::~GridState()
 {
@@ -72,7 +73,8 @@ RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, c
         info.UpdateTimeTracker(t_diff);
         if (info.getTimeTracker().Passed())
         {
-            if (!m.UnloadGrid(x, y, false))
+            bool done = sWorld.getConfig(CONFIG_UINT32_GRID_HIBERNATE_TIME) ? m.HibernateGrid(x, y) : m.UnloadGrid(x, y, false);
+            if (!done)
             {
                 DEBUG_LOG("Grid[%u,%u] for map %u differed unloading due to players or active objects nearby", x, y, m.GetId());
                 m.ResetGridExpiry(grid);
@@ -80,3 +82,20 @@ RemovalState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, c
         }
     }
 }
+
+void
+HibernateState::Update(Map& m, NGridType& grid, GridInfo& info, const uint32& x, const uint32& y, const uint32& t_diff) const
+{
+    if (!info.getUnloadLock())
+    {
+        info.UpdateTimeTracker(t_diff);
+        if (info.getTimeTracker().Passed())
+        {
+            if (!m.UnloadGrid(x, y, false))
+            {
+                DEBUG_LOG("Grid[%u,%u] for map %u differed unloading due to players or active objects nearby", x, y, m.GetId());
+                grid.ResetTimeTracker(sWorld.getConfig(CONFIG_UINT32_GRID_HIBERNATE_TIME));
+            }
+        }
+    }
+}
@@ -63,4 +63,12 @@ class RemovalState : public GridState
         void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
 };
 
+/// Objects stay constructed but parked until GridHibernateTime passes, re-entering only relinks the grid
+class HibernateState : public GridState
+{
+    public:
+
+        void Update(Map&, NGridType&, GridInfo&, const uint32& x, const uint32& y, const uint32& t_diff) const override;
+};
+
 #endif
@@ -129,7 +129,7 @@ MailDraft& MailDraft::AddItem(Item* item)
 /**
  * Prepares the items in a MailDraft.
  */
-bool MailDraft::prepareItems(Player* receiver)
+bool MailDraft::prepareItems(Player* receiver, ItemSaveBatch* batch)
 {
     if (!m_mailTemplateId || !m_mailTemplateItemsNeed)
     {
@@ -150,7 +150,7 @@ bool MailDraft::prepareItems(Player* receiver)
         {
             if (Item* item = Item::CreateItem(lootitem->itemid, lootitem->count, receiver))
             {
-                item->SaveToDB();                           // save for prevent lost at next mail load, if send fail then item will deleted
+                item->SaveToDB(batch);                      // save for prevent lost at next mail load, if send fail then item will deleted
                 AddItem(item);
             }
         }
@@ -183,8 +183,9 @@ void MailDraft::deleteIncludedItems(bool inDB /**= false*/)
  * Clone MailDraft from another MailDraft.
  *
  * @param draft Point to source for draft cloning.
+ * @param batch Queues the saves of the cloned items when given.
  */
-void MailDraft::CloneFrom(MailDraft const& draft)
+void MailDraft::CloneFrom(MailDraft const& draft, ItemSaveBatch* batch)
 {
     m_mailTemplateId = draft.GetMailTemplateId();
     m_mailTemplateItemsNeed = draft.m_mailTemplateItemsNeed;
@@ -200,7 +201,7 @@ void MailDraft::CloneFrom(MailDraft const& draft)
 
         if (Item* newitem = item->CloneItem(item->GetCount()))
         {
-            newitem->SaveToDB();
+            newitem->SaveToDB(batch);
             AddItem(newitem);
         }
     }
@@ -261,8 +262,9 @@ void MailDraft::SendReturnToSender(uint32 sender_acc, ObjectGuid sender_guid, Ob
  * @param sender               The MailSender from which this mail is originated.
  * @param checked              The mask used to specify the mail.
  * @param deliver_delay        The delay after which the mail is delivered in seconds
+ * @param batch                Queues the database rows of the mail when given, items of the draft must not be queued in it unsaved if the receiver may not exist.
  */
-void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked, uint32 deliver_delay)
+void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked, uint32 deliver_delay, MailSendBatch* batch)
 {
     Player* pReceiver = receiver.GetPlayer();               // can be NULL
 
@@ -283,7 +285,7 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
     // generate mail template items for online player, for offline player items will generated at open
     if (pReceiver)
     {
-        if (prepareItems(pReceiver))
+        if (prepareItems(pReceiver, batch ? &batch->GetItems() : NULL))
         {
             has_items = true;
         }
@@ -329,18 +331,31 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
     std::string safe_body = GetBody();
     CharacterDatabase.escape_string(safe_body);
 
-    CharacterDatabase.BeginTransaction();
-    CharacterDatabase.PExecute("INSERT INTO `mail` (`id`,`messageType`,`stationery`,`mailTemplateId`,`sender`,`receiver`,`subject`,`body`,`has_items`,`expire_time`,`deliver_time`,`money`,`cod`,`checked`) "
-                               "VALUES ('%u', '%u', '%u', '%u', '%u', '%u', '%s', '%s', '%u', '" UI64FMTD "','" UI64FMTD "', '%u', '%u', '%u')",
-                               mailId, sender.GetMailMessageType(), sender.GetStationery(), GetMailTemplateId(), sender.GetSenderId(), receiver.GetPlayerGuid().GetCounter(), safe_subject.c_str(), safe_body.c_str(), (has_items ? 1 : 0), (uint64)expire_time, (uint64)deliver_time, m_money, m_COD, checked);
+    if (batch)
+    {
+        batch->AddMail(mailId, sender, GetMailTemplateId(), receiver.GetPlayerGuid().GetCounter(), safe_subject, safe_body, has_items, expire_time, deliver_time, m_money, m_COD, checked);
 
-    for (MailItemMap::const_iterator mailItemIter = m_items.begin(); mailItemIter != m_items.end(); ++mailItemIter)
+        for (MailItemMap::const_iterator mailItemIter = m_items.begin(); mailItemIter != m_items.end(); ++mailItemIter)
+        {
+            Item* item = mailItemIter->second;
+            batch->AddMailItem(mailId, item->GetGUIDLow(), item->GetEntry(), receiver.GetPlayerGuid().GetCounter());
+        }
+    }
+    else
     {
-        Item* item = mailItemIter->second;
-        CharacterDatabase.PExecute("INSERT INTO `mail_items` (`mail_id`,`item_guid`,`item_template`,`receiver`) VALUES ('%u', '%u', '%u','%u')",
-                                   mailId, item->GetGUIDLow(), item->GetEntry(), receiver.GetPlayerGuid().GetCounter());
+        CharacterDatabase.BeginTransaction();
+        CharacterDatabase.PExecute("INSERT INTO `mail` (`id`,`messageType`,`stationery`,`mailTemplateId`,`sender`,`receiver`,`subject`,`body`,`has_items`,`expire_time`,`deliver_time`,`money`,`cod`,`checked`) "
+                                   "VALUES ('%u', '%u', '%u', '%u', '%u', '%u', '%s', '%s', '%u', '" UI64FMTD "','" UI64FMTD "', '%u', '%u', '%u')",
+                                   mailId, sender.GetMailMessageType(), sender.GetStationery(), GetMailTemplateId(), sender.GetSenderId(), receiver.GetPlayerGuid().GetCounter(), safe_subject.c_str(), safe_body.c_str(), (has_items ? 1 : 0), (uint64)expire_time, (uint64)deliver_time, m_money, m_COD, checked);
+
+        for (MailItemMap::const_iterator mailItemIter = m_items.begin(); mailItemIter != m_items.end(); ++mailItemIter)
+        {
+            Item* item = mailItemIter->second;
+            CharacterDatabase.PExecute("INSERT INTO `mail_items` (`mail_id`,`item_guid`,`item_template`,`receiver`) VALUES ('%u', '%u', '%u','%u')",
+                                       mailId, item->GetGUIDLow(), item->GetEntry(), receiver.GetPlayerGuid().GetCounter());
+        }
+        CharacterDatabase.CommitTransaction();
     }
-    CharacterDatabase.CommitTransaction();
 
     // For online receiver update in game mail status and data
     if (pReceiver)
@@ -431,4 +446,65 @@ void Mail::prepareTemplateItems(Player* receiver)
     CharacterDatabase.CommitTransaction();
 }
 
+
+// rows per multi-row INSERT, keeps a single statement well below max_allowed_packet
+#define MAIL_SEND_BATCH_ROWS 100
+
+void MailSendBatch::AddMail(uint32 mailId, MailSender const& sender, uint16 mailTemplateId, uint32 receiverGuidLow, std::string const& safeSubject, std::string const& safeBody,
+                            bool hasItems, time_t expireTime, time_t deliverTime, uint32 money, uint32 COD, uint32 checked)
+{
+    std::ostringstream ss;
+    ss << "('" << mailId << "','" << uint32(sender.GetMailMessageType()) << "','" << uint32(sender.GetStationery()) << "','" << mailTemplateId
+       << "','" << sender.GetSenderId() << "','" << receiverGuidLow << "','" << safeSubject << "','" << safeBody << "','" << (hasItems ? 1 : 0)
+       << "','" << uint64(expireTime) << "','" << uint64(deliverTime) << "','" << money << "','" << COD << "','" << checked << "')";
+    m_mails.push_back(ss.str());
+}
+
+void MailSendBatch::AddMailItem(uint32 mailId, uint32 itemGuidLow, uint32 itemEntry, uint32 receiverGuidLow)
+{
+    MailItemRow row;
+    row.mailId = mailId;
+    row.itemGuidLow = itemGuidLow;
+    row.itemEntry = itemEntry;
+    row.receiverGuidLow = receiverGuidLow;
+    m_mailItems.push_back(row);
+}
+
+void MailSendBatch::Flush()
+{
+    m_items.Flush();
+
+    std::ostringstream ss;
+    uint32 rows = 0;
+    for (std::vector<std::string>::const_iterator itr = m_mails.begin(); itr != m_mails.end(); ++itr)
+    {
+        ss << (rows == 0 ? "INSERT INTO `mail` (`id`,`messageType`,`stationery`,`mailTemplateId`,`sender`,`receiver`,`subject`,`body`,`has_items`,`expire_time`,`deliver_time`,`money`,`cod`,`checked`) VALUES " : ",");
+        ss << *itr;
+
+        if (++rows == MAIL_SEND_BATCH_ROWS || itr + 1 == m_mails.end())
+        {
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    // No SQL injection (no strings)
+    for (std::vector<MailItemRow>::const_iterator itr = m_mailItems.begin(); itr != m_mailItems.end(); ++itr)
+    {
+        ss << (rows == 0 ? "INSERT INTO `mail_items` (`mail_id`,`item_guid`,`item_template`,`receiver`) VALUES " : ",");
+        ss << "('" << itr->mailId << "','" << itr->itemGuidLow << "','" << itr->itemEntry << "','" << itr->receiverGuidLow << "')";
+
+        if (++rows == MAIL_SEND_BATCH_ROWS || itr + 1 == m_mailItems.end())
+        {
+            CharacterDatabase.Execute(ss.str().c_str());
+            ss.str("");
+            rows = 0;
+        }
+    }
+
+    m_mails.clear();
+    m_mailItems.clear();
+}
+
 /*! @} */
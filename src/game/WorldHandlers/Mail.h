@@ -43,9 +43,12 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <vector>
 
 struct AuctionEntry;
 class Item;
+class ItemSaveBatch;
+class MailSendBatch;
 class Object;
 class Player;
 
@@ -251,16 +254,16 @@ class MailDraft
          */
         MailDraft& SetCOD(uint32 COD) { m_COD = COD; return *this; }
 
-        void CloneFrom(MailDraft const& draft);
+        void CloneFrom(MailDraft const& draft, ItemSaveBatch* batch = NULL);
     public:                                                 // finishers
         void SendReturnToSender(uint32 sender_acc, ObjectGuid sender_guid, ObjectGuid receiver_guid);
-        void SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0);
+        void SendMailTo(MailReceiver const& receiver, MailSender const& sender, MailCheckMask checked = MAIL_CHECK_MASK_NONE, uint32 deliver_delay = 0, MailSendBatch* batch = NULL);
     private:
         MailDraft(MailDraft const&);                        // trap decl, no body, mail draft must cloned only explicitly...
         MailDraft& operator=(MailDraft const&);             // trap decl, no body, ...because items clone is high price operation
 
         void deleteIncludedItems(bool inDB = false);
-        bool prepareItems(Player* receiver);                ///< called from SendMailTo for generate mailTemplateBase items
+        bool prepareItems(Player* receiver, ItemSaveBatch* batch);  ///< called from SendMailTo for generate mailTemplateBase items
 
         /// The ID of the template associated with this MailDraft.
         uint16      m_mailTemplateId;
@@ -279,6 +282,45 @@ class MailDraft
         uint32 m_COD;
 };
 
+/**
+ * @brief Collects the rows of many sent mails for multi-row INSERTs.
+ *
+ * MailDraft::SendMailTo() queues its `mail` and `mail_items` rows here
+ * instead of writing them one mail at a time, and saves the items it creates
+ * into the item batch given at construction. Flush() writes the items, then
+ * the mails, inside the transaction the caller has open.
+ */
+class MailSendBatch
+{
+    public:
+        explicit MailSendBatch(ItemSaveBatch& items) : m_items(items) {}
+
+        ItemSaveBatch& GetItems() { return m_items; }
+
+        /// @param safeSubject, safeBody already escaped
+        void AddMail(uint32 mailId, MailSender const& sender, uint16 mailTemplateId, uint32 receiverGuidLow, std::string const& safeSubject, std::string const& safeBody,
+                     bool hasItems, time_t expireTime, time_t deliverTime, uint32 money, uint32 COD, uint32 checked);
+        void AddMailItem(uint32 mailId, uint32 itemGuidLow, uint32 itemEntry, uint32 receiverGuidLow);
+
+        void Flush();
+
+    private:
+        struct MailItemRow
+        {
+            uint32 mailId;
+            uint32 itemGuidLow;
+            uint32 itemEntry;
+            uint32 receiverGuidLow;
+        };
+
+        MailSendBatch(MailSendBatch const&);
+        MailSendBatch& operator=(MailSendBatch const&);
+
+        ItemSaveBatch& m_items;
+        std::vector<std::string> m_mails;                   ///< value tuples of the mail rows
+        std::vector<MailItemRow> m_mailItems;
+};
+
 /**
  * Structure holding information about an item in the mail.
  */
@@ -44,6 +44,7 @@
 #include "Weather.h"
 #include "Transports.h"
 #include "ObjectGridLoader.h"
+#include "TickProfiler.h"
 
 #ifdef ENABLE_ELUNA
 #include "LuaEngine.h"
@@ -123,8 +124,8 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
       i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
       m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_persistentState(NULL),
       m_activeNonPlayersIter(m_activeNonPlayers.end()),
-      i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
-      i_data(NULL)
+      i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)), m_updateTick(0),
+      i_data(NULL), m_fullPathBuilds(0), m_incrementalPathBuilds(0)
 {
 #ifdef ENABLE_ELUNA
     // lua state begins uninitialized
@@ -315,6 +316,14 @@ Map::EnsureGridLoadedAtEnter(const Cell& cell, Player* player)
     else
     {
         grid = getNGrid(cell.GridX(), cell.GridY());
+
+        // objects of a hibernating grid are still in place, waking it is all a reload needs
+        if (grid->GetGridState() == GRID_STATE_HIBERNATE)
+        {
+            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Waking hibernated grid[%u,%u] on map %u", cell.GridX(), cell.GridY(), i_id);
+            ResetGridExpiry(*grid, 0.1f);
+            grid->SetGridState(GRID_STATE_ACTIVE);
+        }
     }
 
     if (player)
@@ -536,43 +545,82 @@ bool Map::loaded(const GridPair& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj,
-                             TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer> &gridVisitor,
-                             TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::AddNearbyCellsOf(WorldObject* obj)
 {
     if (!obj->IsPositionValid())
     {
         return;
     }
 
+    float nearDist = sWorld.getConfig(CONFIG_FLOAT_UPDATE_LOD_NEAR_DISTANCE);
+    float midDist = sWorld.getConfig(CONFIG_FLOAT_UPDATE_LOD_MID_DISTANCE);
+
     // lets update mobs/objects in ALL visible cells around player!
     CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), GetVisibilityDistance());
+    CellPair center = MaNGOS::ComputeCellPair(obj->GetPositionX(), obj->GetPositionY());
 
     for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
     {
         for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
         {
-            // marked cells are those that have been visited
-            // don't visit the same cell twice
-            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            if (!isCellMarked(cell_id))
-            {
-                markCell(cell_id);
-                CellPair pair(x, y);
-                Cell cell(pair);
-                cell.SetNoCreate();
-                Visit(cell, gridVisitor);
-                Visit(cell, worldVisitor);
-            }
+            // nothing of a cell n cells away is closer than n - 1 cells
+            uint32 cellDist = std::max(x > center.x_coord ? x - center.x_coord : center.x_coord - x,
+                                       y > center.y_coord ? y - center.y_coord : center.y_coord - y);
+            float minDist = cellDist ? (cellDist - 1) * SIZE_OF_GRID_CELL : 0.0f;
+
+            UpdateLODTier tier = minDist < nearDist ? UPDATE_LOD_NEAR : (minDist < midDist ? UPDATE_LOD_MID : UPDATE_LOD_FAR);
+            m_updateCells.push_back(UpdateCellList::value_type((y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x, tier));
         }
     }
 }
 
+void Map::UpdateCells(const uint32& t_diff)
+{
+    // by cell and then tier, so the first entry of a cell has its lowest tier
+    std::sort(m_updateCells.begin(), m_updateCells.end());
+
+    MaNGOS::ObjectUpdater updater(t_diff, ++m_updateTick);
+    // for creature
+    TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+    // for pets
+    TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+
+    for (UpdateCellList::const_iterator itr = m_updateCells.begin(); itr != m_updateCells.end(); ++itr)
+    {
+        // don't visit the same cell twice
+        if (itr != m_updateCells.begin() && (itr - 1)->first == itr->first)
+        {
+            continue;
+        }
+
+        updater.i_tier = UpdateLODTier(itr->second);
+
+        CellPair pair(itr->first % TOTAL_NUMBER_OF_CELLS_PER_MAP, itr->first / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        Cell cell(pair);
+        cell.SetNoCreate();
+        Visit(cell, grid_object_update);
+        Visit(cell, world_object_update);
+    }
+
+    m_updateCells.clear();
+
+    // the profiler reads one counter per update tier
+    static_assert(MAX_PERF_UPDATE_TIERS == MAX_UPDATE_LOD_TIERS, "profiler tiers must match the update LOD tiers");
+
+    if (sTickProfiler.IsEnabled())
+    {
+        sTickProfiler.RecordUpdateTiers(updater.i_objects, updater.i_updates);
+    }
+}
+
 void Map::Update(const uint32& t_diff)
 {
+    PerfScope perfMap(PERF_MAP_UPDATE, GetId());
+
     m_dyn_tree.update(t_diff);
 
     /// update worldsessions for existing players
+    PerfScope perfPhase(PERF_MAP_SESSIONS);
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* plr = m_mapRefIter->getSource();
@@ -586,6 +634,7 @@ void Map::Update(const uint32& t_diff)
     }
 
     /// update players at tick
+    perfPhase.Next(PERF_MAP_PLAYERS);
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
         Player* plr = m_mapRefIter->getSource();
@@ -596,21 +645,22 @@ void Map::Update(const uint32& t_diff)
         }
     }
 
-    /// update local transports
+    /// update local transports and the global ones currently on this map
+    perfPhase.Next(PERF_MAP_TRANSPORTS);
     for (std::set<Transport*>::iterator t = i_transports.begin(); t != i_transports.end(); ++t)
     {
         WorldObject::UpdateHelper helper(*t);
         helper.Update(t_diff);
     }
 
-    /// update active cells around players and active objects
-    resetMarkedCells();
+    for (std::set<GlobalTransport*>::iterator t = i_globalTransports.begin(); t != i_globalTransports.end(); ++t)
+    {
+        WorldObject::UpdateHelper helper(*t);
+        helper.Update(t_diff);
+    }
 
-    MaNGOS::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+    /// update active cells around players and active objects
+    perfPhase.Next(PERF_MAP_CELLS);
 
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
@@ -623,7 +673,7 @@ void Map::Update(const uint32& t_diff)
             continue;
         }
 
-        VisitNearbyCellsOf(plr, grid_object_update, world_object_update);
+        AddNearbyCellsOf(plr);
 
         // Collect and remove references to creatures too far away from player's m_HostileRefManager
         // Combat state will change on next tick, if case
@@ -652,7 +702,7 @@ void Map::Update(const uint32& t_diff)
 
                 href.deleteReference(*it);
 
-                VisitNearbyCellsOf(*it, grid_object_update, world_object_update);
+                AddNearbyCellsOf(*it);
             }
         }
     }
@@ -674,13 +724,18 @@ void Map::Update(const uint32& t_diff)
                 continue;
             }
 
-            VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+            AddNearbyCellsOf(obj);
         }
     }
 
+    UpdateCells(t_diff);
+
     // Send world objects and item update field changes
+    perfPhase.Next(PERF_MAP_OBJECT_UPDATES);
     SendObjectUpdates();
 
+    perfPhase.Next(PERF_MAP_GRIDS);
+
     // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattleGround())
@@ -696,6 +751,7 @@ void Map::Update(const uint32& t_diff)
     }
 
     ///- Process necessary scripts
+    perfPhase.Next(PERF_MAP_SCRIPTS);
     if (!m_scriptSchedule.empty())
     {
         ScriptsProcess();
@@ -1009,6 +1065,34 @@ bool Map::UnloadGrid(const uint32& x, const uint32& y, bool pForce)
     return true;
 }
 
+bool Map::HibernateGrid(const uint32& x, const uint32& y)
+{
+    NGridType* grid = getNGrid(x, y);
+    MANGOS_ASSERT(grid != NULL);
+
+    if (ActiveObjectsNearGrid(x, y))
+    {
+        return false;
+    }
+
+    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Hibernating grid[%u,%u] for map %u", x, y, i_id);
+
+    // same preparation as UnloadGrid, so the parked objects look like a fresh load when the grid is relinked
+    ObjectGridUnloader unloader(*grid);
+    RemoveAllObjectsInRemoveList();
+    unloader.MoveToRespawnN();
+    RemoveAllObjectsInRemoveList();
+
+    if (!sWorld.getConfig(CONFIG_BOOL_SAVE_RESPAWN_TIME_IMMEDIATELY))
+    {
+        unloader.SaveRespawnTimesN();
+    }
+
+    grid->ResetTimeTracker(sWorld.getConfig(CONFIG_UINT32_GRID_HIBERNATE_TIME));
+    grid->SetGridState(GRID_STATE_HIBERNATE);
+    return true;
+}
+
 void Map::UnloadAll(bool pForce)
 {
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
@@ -46,7 +46,6 @@
 #include "LuaValue.h"
 #endif /* ENABLE_ELUNA */
 
-#include <bitset>
 
 struct CreatureInfo;
 class Creature;
@@ -67,6 +66,7 @@ class GridMap;
 class GameObjectModel;
 class WeatherSystem;
 class Transport;
+class GlobalTransport;
 
 namespace MaNGOS { struct ObjectUpdater; }
 
@@ -153,7 +153,8 @@ class Map : public GridRefManager<NGridType>
         bool IsRemovalGrid(float x, float y) const
         {
             GridPair p = MaNGOS::ComputeGridPair(x, y);
-            return (!getNGrid(p.x_coord, p.y_coord) || getNGrid(p.x_coord, p.y_coord)->GetGridState() == GRID_STATE_REMOVAL);
+            NGridType const* grid = getNGrid(p.x_coord, p.y_coord);
+            return !grid || grid->GetGridState() == GRID_STATE_REMOVAL || grid->GetGridState() == GRID_STATE_HIBERNATE;
         }
 
         bool IsLoaded(float x, float y) const
@@ -166,6 +167,7 @@ class Map : public GridRefManager<NGridType>
         void SetUnloadLock(const GridPair& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void ForceLoadGrid(float x, float y);
         bool UnloadGrid(const uint32& x, const uint32& y, bool pForce);
+        bool HibernateGrid(const uint32& x, const uint32& y);
         virtual void UnloadAll(bool pForce);
 
         void ResetGridExpiry(NGridType& grid, float factor = 1) const
@@ -202,10 +204,6 @@ class Map : public GridRefManager<NGridType>
 
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, CellPair cellpair);
 
-        void resetMarkedCells() { marked_cells.reset(); }
-        bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-        void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
-
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(uint32 x, uint32 y) const;
@@ -306,6 +304,23 @@ class Map : public GridRefManager<NGridType>
 
         void LoadLocalTransports();
 
+        /**
+         * @brief Global transports currently on this map, updated in this map's Update().
+         *
+         * A transport reaching a map change or teleport node is handed off with
+         * AddTransportHandoff() and teleported by MapManager::Update() after all
+         * map updates finished, since that moves passengers between maps.
+         */
+        void AddGlobalTransport(GlobalTransport* transport) { i_globalTransports.insert(transport); }
+        void RemoveGlobalTransport(GlobalTransport* transport) { i_globalTransports.erase(transport); }
+        void AddTransportHandoff(GlobalTransport* transport) { i_transportHandoffs.push_back(transport); }
+        void TakeTransportHandoffs(std::vector<GlobalTransport*>& transports) { transports.swap(i_transportHandoffs); }
+
+        // Pathfinding statistics, only updated from this map's update thread
+        void AddPathBuild(bool incremental) { if (incremental) { ++m_incrementalPathBuilds; } else { ++m_fullPathBuilds; } }
+        uint32 GetFullPathBuildCount() const { return m_fullPathBuilds; }
+        uint32 GetIncrementalPathBuildCount() const { return m_incrementalPathBuilds; }
+
 #ifdef ENABLE_ELUNA
         Eluna* GetEluna() const;
 
@@ -338,9 +353,10 @@ class Map : public GridRefManager<NGridType>
             return i_grids[x][y];
         }
 
-        void VisitNearbyCellsOf(WorldObject* obj,
-                                TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer> &gridVisitor,
-                                TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        /// Adds the cells in visibility range of @p obj to m_updateCells, with their update tier as seen from it.
+        void AddNearbyCellsOf(WorldObject* obj);
+        /// Updates the objects of all m_updateCells, each cell once at the lowest tier it was added with.
+        void UpdateCells(const uint32& t_diff);
 
         bool isGridObjectDataLoaded(uint32 x, uint32 y) const { return getNGrid(x, y)->isGridObjectDataLoaded(); }
         void setGridObjectDataLoaded(bool pLoaded, uint32 x, uint32 y) { getNGrid(x, y)->setGridObjectDataLoaded(pLoaded); }
@@ -376,10 +392,14 @@ class Map : public GridRefManager<NGridType>
         TerrainInfo* const m_TerrainData;
         bool m_bLoadedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
-        std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        typedef std::vector<std::pair<uint32, uint32> > UpdateCellList;     // cell id, UpdateLODTier
+        UpdateCellList m_updateCells;                       // cells to update this tick, may repeat a cell
+        uint32 m_updateTick;
 
         std::set<WorldObject*> i_objectsToRemove;
         std::set<Transport*> i_transports;
+        std::set<GlobalTransport*> i_globalTransports;     // owned by MapManager
+        std::vector<GlobalTransport*> i_transportHandoffs;  // filled by this map's update, emptied by MapManager::Update()
 
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
@@ -407,6 +427,10 @@ class Map : public GridRefManager<NGridType>
         // WeatherSystem
         WeatherSystem* m_weatherSystem;
 
+        // Path builds that ran a full findPath vs. reused the previous corridor
+        uint32 m_fullPathBuilds;
+        uint32 m_incrementalPathBuilds;
+
 #ifdef ENABLE_ELUNA
         Eluna* eluna;
 #endif /* ENABLE_ELUNA */
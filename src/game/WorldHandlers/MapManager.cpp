@@ -92,6 +92,7 @@ void MapManager::InitStateMachine()
     si_GridStates[GRID_STATE_ACTIVE] = new ActiveState;
     si_GridStates[GRID_STATE_IDLE] = new IdleState;
     si_GridStates[GRID_STATE_REMOVAL] = new RemovalState;
+    si_GridStates[GRID_STATE_HIBERNATE] = new HibernateState;
 }
 
 void MapManager::DeleteStateMachine()
@@ -100,6 +101,7 @@ void MapManager::DeleteStateMachine()
     delete si_GridStates[GRID_STATE_ACTIVE];
     delete si_GridStates[GRID_STATE_IDLE];
     delete si_GridStates[GRID_STATE_REMOVAL];
+    delete si_GridStates[GRID_STATE_HIBERNATE];
 }
 
 void MapManager::UpdateGridState(grid_state_t state, Map& map, NGridType& ngrid, GridInfo& ginfo, const uint32& x, const uint32& y, const uint32& t_diff)
@@ -233,10 +235,21 @@ void MapManager::Update(uint32 diff)
         m_updater.wait();
     }
 
-    for (TransportSet::iterator iter = m_Transports.begin(); iter != m_Transports.end(); ++iter)
+    // global transports were updated by their maps, teleports move passengers between maps so they are done here
+    std::vector<GlobalTransport*> handoffs;
+    for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end(); ++iter)
     {
-        WorldObject::UpdateHelper helper((*iter));
-        helper.Update((uint32)i_timer.GetCurrent());
+        iter->second->TakeTransportHandoffs(handoffs);
+        for (std::vector<GlobalTransport*>::iterator t = handoffs.begin(); t != handoffs.end(); ++t)
+        {
+            (*t)->TeleportToNextWayPoint();
+            if ((*t)->GetMap() != iter->second)
+            {
+                iter->second->RemoveGlobalTransport(*t);
+                (*t)->GetMap()->AddGlobalTransport(*t);
+            }
+        }
+        handoffs.clear();
     }
 
     // remove all maps which can be unloaded
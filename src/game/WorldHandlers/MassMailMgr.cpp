@@ -38,6 +38,7 @@
 #include "SharedDefines.h"
 #include "World.h"
 #include "ObjectMgr.h"
+#include "Item.h"
 
 INSTANTIATE_SINGLETON_1(MassMailMgr);
 
@@ -88,44 +89,62 @@ void MassMailMgr::Update(bool sendall /*= false*/)
         return;
     }
 
-    uint32 maxcount = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
+    uint32 batchSize = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
 
     do
+    {
+        SendBatch(batchSize);
+    }
+    while (sendall && !m_massMails.empty());
+}
+
+void MassMailMgr::SendBatch(uint32 count)
+{
+    ItemSaveBatch items;
+    MailSendBatch mails(items);
+    std::vector<uint32> receivers;
+
+    CharacterDatabase.BeginTransaction();
+
+    while (count > 0 && !m_massMails.empty())
     {
         MassMail& task = m_massMails.front();
 
-        while (!task.m_receivers.empty() && (sendall || maxcount > 0))
+        // take the receivers of this batch off the list in one go
+        receivers.clear();
+        ReceiversList::iterator last = task.m_receivers.begin();
+        for (; last != task.m_receivers.end() && receivers.size() < count; ++last)
         {
-            uint32 receiver_lowguid = *task.m_receivers.begin();
-            task.m_receivers.erase(task.m_receivers.begin());
+            receivers.push_back(*last);
+        }
+        task.m_receivers.erase(task.m_receivers.begin(), last);
+        count -= receivers.size();
 
-            ObjectGuid receiver_guid = ObjectGuid(HIGHGUID_PLAYER, receiver_lowguid);
+        for (std::vector<uint32>::const_iterator itr = receivers.begin(); itr != receivers.end(); ++itr)
+        {
+            ObjectGuid receiver_guid = ObjectGuid(HIGHGUID_PLAYER, *itr);
             Player* receiver = sObjectMgr.GetPlayer(receiver_guid);
 
-            // last case. can be just send
-            if (task.m_receivers.empty())
+            // last case. can be just send, the prototype items are already saved
+            if (task.m_receivers.empty() && itr + 1 == receivers.end())
             {
                 // prevent mail return
-                task.m_protoMail->SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
-
-                if (!sendall)
-                {
-                    --maxcount;
-                }
+                task.m_protoMail->SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED, 0, &mails);
                 break;
             }
 
+            // no clones for deleted characters, queued item rows can't be taken back
+            if (!receiver && !sObjectMgr.GetPlayerAccountIdByGUID(receiver_guid))
+            {
+                continue;
+            }
+
             // need clone draft
             MailDraft draft;
-            draft.CloneFrom(*task.m_protoMail);
+            draft.CloneFrom(*task.m_protoMail, &items);
 
             // prevent mail return
-            draft.SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
-
-            if (!sendall)
-            {
-                --maxcount;
-            }
+            draft.SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED, 0, &mails);
         }
 
         if (task.m_receivers.empty())
@@ -133,7 +152,9 @@ void MassMailMgr::Update(bool sendall /*= false*/)
             m_massMails.pop_front();
         }
     }
-    while (!m_massMails.empty() && (sendall || maxcount > 0));
+
+    mails.Flush();
+    CharacterDatabase.CommitTransaction();
 }
 
 void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) const
@@ -97,10 +97,16 @@ class MassMailMgr
 
         /**
          * Next step in mass mail activity, send some amount mails from queued tasks
+         *
+         * Each batch of mails is written with multi-row INSERTs in one transaction,
+         * only the mailboxes of online receivers are touched in memory.
          */
         void Update(bool sendall = false);
 
     private:
+        /// Sends up to count mails of the queued tasks, oldest task first.
+        void SendBatch(uint32 count);
+
 
         /// Mass mail task store mail prototype and receivers list who not get mail yet
         struct MassMail
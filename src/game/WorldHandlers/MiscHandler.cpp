@@ -538,38 +538,13 @@ void WorldSession::HandleAddFriendOpcode(WorldPacket& recv_data)
         return;
     }
 
-    CharacterDatabase.escape_string(friendName);            // prevent SQL injection - normal name don't must changed by this call
-
     DEBUG_LOG("WORLD: %s asked to add friend : '%s'",
               GetPlayer()->GetName(), friendName.c_str());
 
-    CharacterDatabase.AsyncPQuery(&WorldSession::HandleAddFriendOpcodeCallBack, GetAccountId(), "SELECT `guid`, `race` FROM `characters` WHERE `name` = '%s'", friendName.c_str());
-}
-
-void WorldSession::HandleAddFriendOpcodeCallBack(QueryResult* result, uint32 accountId)
-{
-    if (!result)
-    {
-        return;
-    }
-
-    uint32 friendLowGuid = (*result)[0].GetUInt32();
-    ObjectGuid friendGuid = ObjectGuid(HIGHGUID_PLAYER, friendLowGuid);
-    Team team = Player::TeamForRace((*result)[1].GetUInt8());
-
-    delete result;
-
-    WorldSession* session = sWorld.FindSession(accountId);
-    if (!session)
-    {
-        return;
-    }
+    ObjectGuid friendGuid = sObjectMgr.GetPlayerGuidByName(friendName);
+    Team team = friendGuid ? sObjectMgr.GetPlayerTeamByGUID(friendGuid) : TEAM_NONE;
 
-    Player* player = session->GetPlayer();
-    if (!player)
-    {
-        return;
-    }
+    Player* player = GetPlayer();
 
     FriendsResult friendResult = FRIEND_NOT_FOUND;
     if (friendGuid)
@@ -578,7 +553,7 @@ void WorldSession::HandleAddFriendOpcodeCallBack(QueryResult* result, uint32 acc
         {
             friendResult = FRIEND_SELF;
         }
-        else if (player->GetTeam() != team && !sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_ADD_FRIEND) && session->GetSecurity() < SEC_MODERATOR)
+        else if (player->GetTeam() != team && !sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_ADD_FRIEND) && GetSecurity() < SEC_MODERATOR)
         {
             friendResult = FRIEND_ENEMY;
         }
@@ -639,37 +614,11 @@ void WorldSession::HandleAddIgnoreOpcode(WorldPacket& recv_data)
         return;
     }
 
-    CharacterDatabase.escape_string(IgnoreName);            // prevent SQL injection - normal name don't must changed by this call
-
     DEBUG_LOG("WORLD: %s asked to Ignore: '%s'",
               GetPlayer()->GetName(), IgnoreName.c_str());
 
-    CharacterDatabase.AsyncPQuery(&WorldSession::HandleAddIgnoreOpcodeCallBack, GetAccountId(), "SELECT `guid` FROM `characters` WHERE `name` = '%s'", IgnoreName.c_str());
-}
-
-void WorldSession::HandleAddIgnoreOpcodeCallBack(QueryResult* result, uint32 accountId)
-{
-    if (!result)
-    {
-        return;
-    }
-
-    uint32 ignoreLowGuid = (*result)[0].GetUInt32();
-    ObjectGuid ignoreGuid = ObjectGuid(HIGHGUID_PLAYER, ignoreLowGuid);
-
-    delete result;
-
-    WorldSession* session = sWorld.FindSession(accountId);
-    if (!session)
-    {
-        return;
-    }
-
-    Player* player = session->GetPlayer();
-    if (!player)
-    {
-        return;
-    }
+    ObjectGuid ignoreGuid = sObjectMgr.GetPlayerGuidByName(IgnoreName);
+    Player* player = GetPlayer();
 
     FriendsResult ignoreResult = FRIEND_IGNORE_NOT_FOUND;
     if (ignoreGuid)
@@ -0,0 +1,289 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "NameLookupIndex.h"
+#include "DBCStores.h"
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "SQLStorages.h"
+#include "Util.h"
+
+#include <cwctype>
+
+INSTANTIATE_SINGLETON_1(NameLookupMgr);
+
+struct NameLookupMatchOrder
+{
+    bool operator()(NameLookupMatch const& a, NameLookupMatch const& b) const
+    {
+        if (a.rank != b.rank)
+        {
+            return a.rank < b.rank;
+        }
+
+        if (a.length != b.length)
+        {
+            return a.length < b.length;
+        }
+
+        return a.id < b.id;
+    }
+};
+
+void NameLookupIndex::Clear()
+{
+    m_names.clear();
+    m_trigrams.clear();
+}
+
+uint64 NameLookupIndex::TrigramKey(wchar_t const* chars)
+{
+    // unicode code points fit in 21 bits
+    return (uint64(chars[0] & 0x1FFFFF) << 42) | (uint64(chars[1] & 0x1FFFFF) << 21) | uint64(chars[2] & 0x1FFFFF);
+}
+
+void NameLookupIndex::AddName(uint32 id, int32 locIdx, std::string const& name)
+{
+    if (name.empty())
+    {
+        return;
+    }
+
+    IndexedName entry;
+    entry.id = id;
+    entry.locIdx = locIdx;
+    if (!Utf8toWStr(name, entry.name))
+    {
+        return;
+    }
+
+    wstrToLower(entry.name);
+
+    uint32 nameIdx = m_names.size();
+    m_names.push_back(entry);
+
+    std::wstring const& lowerName = m_names.back().name;
+    for (size_t i = 0; i + 3 <= lowerName.size(); ++i)
+    {
+        NameList& names = m_trigrams[TrigramKey(&lowerName[i])];
+        // a trigram repeated in one name is listed once
+        if (names.empty() || names.back() != nameIdx)
+        {
+            names.push_back(nameIdx);
+        }
+    }
+}
+
+NameLookupRank NameLookupIndex::GetRank(std::wstring const& name, size_t pos, size_t partLength)
+{
+    if (pos == 0)
+    {
+        return partLength == name.size() ? NAME_LOOKUP_RANK_EXACT : NAME_LOOKUP_RANK_PREFIX;
+    }
+
+    // any other match at a word start counts as well
+    for (; pos != std::wstring::npos; pos = name.find(name.c_str() + pos, pos + 1, partLength))
+    {
+        if (!std::iswalnum(name[pos - 1]))
+        {
+            return NAME_LOOKUP_RANK_WORD;
+        }
+    }
+
+    return NAME_LOOKUP_RANK_SUBSTRING;
+}
+
+void NameLookupIndex::Search(std::wstring const& part, int32 locIdx, bool allLocales, std::vector<NameLookupMatch>& matches) const
+{
+    matches.clear();
+    if (part.empty())
+    {
+        return;
+    }
+
+    // names listed for the rarest trigram of the search, or all names for short searches
+    NameList const* candidates = NULL;
+    for (size_t i = 0; i + 3 <= part.size(); ++i)
+    {
+        TrigramMap::const_iterator itr = m_trigrams.find(TrigramKey(&part[i]));
+        if (itr == m_trigrams.end())
+        {
+            return;
+        }
+
+        if (!candidates || itr->second.size() < candidates->size())
+        {
+            candidates = &itr->second;
+        }
+    }
+
+    uint32 count = candidates ? candidates->size() : m_names.size();
+
+    UNORDERED_MAP<uint32, size_t> matchById;                // best match so far of an id
+    for (uint32 i = 0; i < count; ++i)
+    {
+        IndexedName const& entry = m_names[candidates ? (*candidates)[i] : i];
+        if (!allLocales && entry.locIdx != NAME_LOOKUP_DEFAULT_LOCALE && entry.locIdx != locIdx)
+        {
+            continue;
+        }
+
+        size_t pos = entry.name.find(part);
+        if (pos == std::wstring::npos)
+        {
+            continue;
+        }
+
+        NameLookupMatch match;
+        match.id = entry.id;
+        match.locIdx = entry.locIdx;
+        match.rank = GetRank(entry.name, pos, part.size());
+        match.length = entry.name.size();
+
+        UNORDERED_MAP<uint32, size_t>::iterator found = matchById.find(entry.id);
+        if (found == matchById.end())
+        {
+            matchById[entry.id] = matches.size();
+            matches.push_back(match);
+            continue;
+        }
+
+        NameLookupMatch& best = matches[found->second];
+        if (match.rank < best.rank || (match.rank == best.rank && match.locIdx == locIdx && best.locIdx != locIdx))
+        {
+            best = match;
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), NameLookupMatchOrder());
+}
+
+void NameLookupMgr::LoadAll()
+{
+    for (uint32 i = 0; i < MAX_NAME_LOOKUP_TYPES; ++i)
+    {
+        Load(NameLookupType(i));
+    }
+}
+
+void NameLookupMgr::Load(NameLookupType type)
+{
+    NameLookupIndex& index = m_indexes[type];
+    index.Clear();
+
+    switch (type)
+    {
+        case NAME_LOOKUP_ITEM:
+            for (uint32 id = 0; id < sItemStorage.GetMaxEntry(); ++id)
+            {
+                ItemPrototype const* proto = sItemStorage.LookupEntry<ItemPrototype>(id);
+                if (!proto)
+                {
+                    continue;
+                }
+
+                index.AddName(id, NAME_LOOKUP_DEFAULT_LOCALE, proto->Name1);
+                if (ItemLocale const* il = sObjectMgr.GetItemLocale(id))
+                {
+                    for (uint32 loc = 0; loc < il->Name.size(); ++loc)
+                    {
+                        index.AddName(id, loc, il->Name[loc]);
+                    }
+                }
+            }
+            break;
+        case NAME_LOOKUP_CREATURE:
+            for (uint32 id = 0; id < sCreatureStorage.GetMaxEntry(); ++id)
+            {
+                CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(id);
+                if (!cInfo)
+                {
+                    continue;
+                }
+
+                index.AddName(id, NAME_LOOKUP_DEFAULT_LOCALE, cInfo->Name);
+                if (CreatureLocale const* cl = sObjectMgr.GetCreatureLocale(id))
+                {
+                    for (uint32 loc = 0; loc < cl->Name.size(); ++loc)
+                    {
+                        index.AddName(id, loc, cl->Name[loc]);
+                    }
+                }
+            }
+            break;
+        case NAME_LOOKUP_GAMEOBJECT:
+            for (SQLStorageBase::SQLSIterator<GameObjectInfo> itr = sGOStorage.getDataBegin<GameObjectInfo>(); itr < sGOStorage.getDataEnd<GameObjectInfo>(); ++itr)
+            {
+                index.AddName(itr->id, NAME_LOOKUP_DEFAULT_LOCALE, itr->name);
+                if (GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(itr->id))
+                {
+                    for (uint32 loc = 0; loc < gl->Name.size(); ++loc)
+                    {
+                        index.AddName(itr->id, loc, gl->Name[loc]);
+                    }
+                }
+            }
+            break;
+        case NAME_LOOKUP_QUEST:
+        {
+            ObjectMgr::QuestMap const& qTemplates = sObjectMgr.GetQuestTemplates();
+            for (ObjectMgr::QuestMap::const_iterator itr = qTemplates.begin(); itr != qTemplates.end(); ++itr)
+            {
+                index.AddName(itr->first, NAME_LOOKUP_DEFAULT_LOCALE, itr->second->GetTitle());
+                if (QuestLocale const* ql = sObjectMgr.GetQuestLocale(itr->first))
+                {
+                    for (uint32 loc = 0; loc < ql->Title.size(); ++loc)
+                    {
+                        index.AddName(itr->first, loc, ql->Title[loc]);
+                    }
+                }
+            }
+            break;
+        }
+        case NAME_LOOKUP_SPELL:
+            // Spell.dbc carries all client locales, indexed by LocaleConstant
+            for (uint32 id = 0; id < sSpellStore.GetNumRows(); ++id)
+            {
+                SpellEntry const* spellInfo = sSpellStore.LookupEntry(id);
+                if (!spellInfo)
+                {
+                    continue;
+                }
+
+                for (uint32 loc = 0; loc < MAX_LOCALE; ++loc)
+                {
+                    if (spellInfo->SpellName[loc])
+                    {
+                        index.AddName(id, loc, spellInfo->SpellName[loc]);
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    static char const* typeNames[MAX_NAME_LOOKUP_TYPES] = { "item", "creature", "gameobject", "quest", "spell" };
+    sLog.outString(">> Indexed %u %s names for lookup", index.GetNameCount(), typeNames[type]);
+}
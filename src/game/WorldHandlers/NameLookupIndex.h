@@ -0,0 +1,129 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_H_NAMELOOKUPINDEX
+#define MANGOS_H_NAMELOOKUPINDEX
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <vector>
+
+#define NAME_LOOKUP_DEFAULT_LOCALE  -1                      // locale index of the template's own name
+
+enum NameLookupType
+{
+    NAME_LOOKUP_ITEM,
+    NAME_LOOKUP_CREATURE,
+    NAME_LOOKUP_GAMEOBJECT,
+    NAME_LOOKUP_QUEST,
+    NAME_LOOKUP_SPELL,
+    MAX_NAME_LOOKUP_TYPES
+};
+
+/// How well a name matched, best first.
+enum NameLookupRank
+{
+    NAME_LOOKUP_RANK_EXACT,
+    NAME_LOOKUP_RANK_PREFIX,
+    NAME_LOOKUP_RANK_WORD,                                  // starts a word inside the name
+    NAME_LOOKUP_RANK_SUBSTRING
+};
+
+struct NameLookupMatch
+{
+    uint32 id;
+    int32 locIdx;                                           // locale of the matching name, NAME_LOOKUP_DEFAULT_LOCALE for the default name
+    NameLookupRank rank;
+    uint32 length;                                          // of the matching name, shorter names rank first
+};
+
+/**
+ * @brief Case insensitive substring search over the names of one kind of template.
+ *
+ * Names are stored lower cased as wide strings, with a trigram index from
+ * each trigram to the names containing it. A search of 3 or more characters
+ * only checks the names listed for its rarest trigram, shorter searches
+ * check all names, but no name is converted at search time any more.
+ */
+class NameLookupIndex
+{
+    public:
+        void Clear();
+        /// @param locIdx NAME_LOOKUP_DEFAULT_LOCALE or the index of the localized name
+        void AddName(uint32 id, int32 locIdx, std::string const& name);
+
+        /**
+         * @brief Finds the names containing @p part, best match per id, ranked.
+         *
+         * @param part lower cased search string
+         * @param locIdx only default names and names of this locale can match, unless @p allLocales
+         * @param allLocales search the names of all locales, a match in @p locIdx wins over an equal one in another
+         */
+        void Search(std::wstring const& part, int32 locIdx, bool allLocales, std::vector<NameLookupMatch>& matches) const;
+
+        uint32 GetNameCount() const { return m_names.size(); }
+
+    private:
+        struct IndexedName
+        {
+            uint32 id;
+            int32 locIdx;
+            std::wstring name;
+        };
+
+        typedef std::vector<uint32> NameList;               // indexes into m_names, ascending
+        typedef UNORDERED_MAP<uint64, NameList> TrigramMap;
+
+        static uint64 TrigramKey(wchar_t const* chars);
+        static NameLookupRank GetRank(std::wstring const& name, size_t pos, size_t partLength);
+
+        std::vector<IndexedName> m_names;
+        TrigramMap m_trigrams;
+};
+
+/**
+ * @brief Name indexes of the item, creature, gameobject, quest and spell templates for the lookup commands.
+ *
+ * Built at startup after the locales are loaded, and again by the reload
+ * commands of the templates and locales they cover.
+ */
+class NameLookupMgr
+{
+    public:
+        void LoadAll();
+        void Load(NameLookupType type);
+
+        void Search(NameLookupType type, std::wstring const& part, int32 locIdx, bool allLocales, std::vector<NameLookupMatch>& matches) const
+        {
+            m_indexes[type].Search(part, locIdx, allLocales, matches);
+        }
+
+    private:
+        NameLookupIndex m_indexes[MAX_NAME_LOOKUP_TYPES];
+};
+
+#define sNameLookupMgr MaNGOS::Singleton<NameLookupMgr>::Instance()
+
+#endif
@@ -80,6 +80,26 @@ ObjectGridRespawnMover::Visit(CreatureMapType& m)
     }
 }
 
+class ObjectGridRespawnSaver
+{
+    public:
+        ObjectGridRespawnSaver() {}
+
+        void Save(GridType& grid)
+        {
+            TypeContainerVisitor<ObjectGridRespawnSaver, GridTypeMapContainer > saver(*this);
+            grid.Visit(saver);
+        }
+
+        template<class T> void Visit(GridRefManager<T>& m)
+        {
+            for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                iter->getSource()->SaveRespawnTime();
+            }
+        }
+};
+
 // for loading world object at grid loading (Corpses)
 class ObjectWorldLoader
 {
@@ -275,6 +295,18 @@ void ObjectGridUnloader::MoveToRespawnN()
     }
 }
 
+void ObjectGridUnloader::SaveRespawnTimesN()
+{
+    for (unsigned int x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
+    {
+        for (unsigned int y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
+        {
+            ObjectGridRespawnSaver saver;
+            saver.Save(i_grid(x, y));
+        }
+    }
+}
+
 void
 ObjectGridUnloader::Unload(GridType& grid)
 {
@@ -68,6 +68,7 @@ class ObjectGridUnloader
         ObjectGridUnloader(NGridType& grid) : i_grid(grid) {}
 
         void MoveToRespawnN();
+        void SaveRespawnTimesN();
         void UnloadN()
         {
             GridLoaderType loader;
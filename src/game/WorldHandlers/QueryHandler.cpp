@@ -36,6 +36,7 @@
 #include "Player.h"
 #include "NPCHandler.h"
 #include "SQLStorages.h"
+#include "CharacterDirectory.h"
 
 void WorldSession::SendNameQueryOpcode(Player* p)
 {
@@ -56,51 +57,25 @@ void WorldSession::SendNameQueryOpcode(Player* p)
     SendPacket(&data);
 }
 
-void WorldSession::SendNameQueryOpcodeFromDB(ObjectGuid guid)
+void WorldSession::SendNameQueryOpcodeFromDirectory(ObjectGuid guid)
 {
-    CharacterDatabase.AsyncPQuery(&WorldSession::SendNameQueryOpcodeFromDBCallBack, GetAccountId(),
-                                  //          0     1     2     3       4
-                                  "SELECT guid, name, race, gender, class "
-                                  "FROM characters WHERE guid = '%u'",
-                                  guid.GetCounter());
-}
-
-void WorldSession::SendNameQueryOpcodeFromDBCallBack(QueryResult* result, uint32 accountId)
-{
-    if (!result)
+    // deleted characters kept in the database get an empty name and race/gender/class 0
+    CharacterDirectoryEntry character;
+    if (!sCharacterDirectory.GetCharacter(guid.GetCounter(), character) && !sCharacterDirectory.IsDeletedCharacter(guid.GetCounter()))
     {
         return;
     }
 
-    WorldSession* session = sWorld.FindSession(accountId);
-    if (!session)
-    {
-        delete result;
-        return;
-    }
-
-    Field* fields = result->Fetch();
-    uint32 lowguid      = fields[0].GetUInt32();
-    std::string name = fields[1].GetCppString();
-    uint8 pRace = 0, pGender = 0, pClass = 0;
-    if (!name.empty())
-    {
-        pRace        = fields[2].GetUInt8();
-        pGender      = fields[3].GetUInt8();
-        pClass       = fields[4].GetUInt8();
-    }
-
     // guess size
-    WorldPacket data(SMSG_NAME_QUERY_RESPONSE, (8 + (name.size()+1) + 1 + 4 + 4 + 4));
-    data << ObjectGuid(HIGHGUID_PLAYER, lowguid);
-    data << name;
+    WorldPacket data(SMSG_NAME_QUERY_RESPONSE, (8 + (character.name.size() + 1) + 1 + 4 + 4 + 4));
+    data << guid;
+    data << character.name;
     data << uint8(0);                                       // realm name for cross realm BG usage
-    data << uint32(pRace);                                  // race
-    data << uint32(pGender);                                // gender
-    data << uint32(pClass);                                 // class
+    data << uint32(character.race);                         // race
+    data << uint32(character.gender);                       // gender
+    data << uint32(character.playerClass);                  // class
 
-    session->SendPacket(&data);
-    delete result;
+    SendPacket(&data);
 }
 
 void WorldSession::HandleNameQueryOpcode(WorldPacket& recv_data)
@@ -117,7 +92,7 @@ void WorldSession::HandleNameQueryOpcode(WorldPacket& recv_data)
     }
     else
     {
-        SendNameQueryOpcodeFromDB(guid);
+        SendNameQueryOpcodeFromDirectory(guid);
     }
 }
 
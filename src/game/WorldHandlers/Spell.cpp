@@ -441,11 +441,38 @@ WorldObject* Spell::FindCorpseUsing()
     return result;
 }
 
+#define SPELL_SPARE_UNIT_LISTS          16      // spare target lists kept per thread
+#define SPELL_SPARE_UNIT_LIST_CAPACITY  256     // bigger lists are freed so a rare huge AoE does not pin the memory
+
+namespace
+{
+    thread_local std::vector<Spell::UnitList> spareUnitLists;
+}
+
+PooledUnitList::PooledUnitList()
+{
+    if (!spareUnitLists.empty())
+    {
+        swap(spareUnitLists.back());
+        spareUnitLists.pop_back();
+    }
+}
+
+PooledUnitList::~PooledUnitList()
+{
+    if (spareUnitLists.size() < SPELL_SPARE_UNIT_LISTS && capacity() <= SPELL_SPARE_UNIT_LIST_CAPACITY)
+    {
+        clear();
+        spareUnitLists.push_back(Spell::UnitList());
+        spareUnitLists.back().swap(*this);
+    }
+}
+
 void Spell::FillTargetMap()
 {
     // TODO: ADD the correct target FILLS!!!!!!
 
-    UnitList tmpUnitLists[MAX_EFFECT_INDEX];                // Stores the temporary Target Lists for each effect
+    PooledUnitList tmpUnitLists[MAX_EFFECT_INDEX];          // Stores the temporary Target Lists for each effect
     uint8 effToIndex[MAX_EFFECT_INDEX] = {0, 1, 2};         // Helper array, to link to another tmpUnitList, if the targets for both effects match
     for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
     {
@@ -834,7 +861,7 @@ void Spell::prepareDataForTriggerSystem()
     m_negativeEffectMask = 0x0;
     for (int i = 0; i < MAX_EFFECT_INDEX; ++i)
     {
-        if (m_spellInfo->Effect[i] != SPELL_EFFECT_NONE && !IsPositiveEffect(m_spellInfo, SpellEffectIndex(i)))
+        if (m_spellInfo->Effect[i] != SPELL_EFFECT_NONE && !IsPositiveEffect(m_spellInfo->Id, SpellEffectIndex(i)))
         {
             m_negativeEffectMask |= (1 << i);
         }
@@ -1811,14 +1838,14 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
             unMaxTargets = EffectChainTarget;
             float max_range = radius + unMaxTargets * CHAIN_SPELL_JUMP_RADIUS;
 
-            UnitList tempTargetUnitMap;
+            PooledUnitList tempTargetUnitMap;
 
             switch (targetMode)
             {
                 case TARGET_RANDOM_ENEMY_CHAIN_IN_AREA:
                 {
                     MaNGOS::AnyAoETargetUnitInObjectRangeCheck u_check(m_caster, max_range);
-                    MaNGOS::UnitListSearcher<MaNGOS::AnyAoETargetUnitInObjectRangeCheck> searcher(tempTargetUnitMap, u_check);
+                    MaNGOS::UnitListSearcher<MaNGOS::AnyAoETargetUnitInObjectRangeCheck, UnitList> searcher(tempTargetUnitMap, u_check);
                     Cell::VisitAllObjects(m_caster, searcher, max_range);
                     break;
                 }
@@ -1826,7 +1853,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 case TARGET_RANDOM_FRIEND_CHAIN_IN_AREA:
                 {
                     MaNGOS::AnyFriendlyUnitInObjectRangeCheck u_check(m_caster, max_range);
-                    MaNGOS::UnitListSearcher<MaNGOS::AnyFriendlyUnitInObjectRangeCheck> searcher(tempTargetUnitMap, u_check);
+                    MaNGOS::UnitListSearcher<MaNGOS::AnyFriendlyUnitInObjectRangeCheck, UnitList> searcher(tempTargetUnitMap, u_check);
                     Cell::VisitAllObjects(m_caster, searcher, max_range);
                     break;
                 }
@@ -1837,7 +1864,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 break;
             }
 
-            tempTargetUnitMap.sort(TargetDistanceOrderNear(m_caster));
+            std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(m_caster));
 
             // Now to get us a random target that's in the initial range of the spell
             uint32 t = 0;
@@ -1859,7 +1886,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
 
             tempTargetUnitMap.erase(itr);
 
-            tempTargetUnitMap.sort(TargetDistanceOrderNear(pUnitTarget));
+            std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(pUnitTarget));
 
             t = unMaxTargets - 1;
             Unit* prev = pUnitTarget;
@@ -1880,7 +1907,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 prev = *next;
                 targetUnitMap.push_back(prev);
                 tempTargetUnitMap.erase(next);
-                tempTargetUnitMap.sort(TargetDistanceOrderNear(prev));
+                std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(prev));
                 next = tempTargetUnitMap.begin();
                 --t;
             }
@@ -1928,10 +1955,10 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                     max_range = radius + unMaxTargets * CHAIN_SPELL_JUMP_RADIUS;
                 }
 
-                UnitList tempTargetUnitMap;
+                PooledUnitList tempTargetUnitMap;
                 {
                     MaNGOS::AnyAoEVisibleTargetUnitInObjectRangeCheck u_check(pUnitTarget, originalCaster, max_range);
-                    MaNGOS::UnitListSearcher<MaNGOS::AnyAoEVisibleTargetUnitInObjectRangeCheck> searcher(tempTargetUnitMap, u_check);
+                    MaNGOS::UnitListSearcher<MaNGOS::AnyAoEVisibleTargetUnitInObjectRangeCheck, UnitList> searcher(tempTargetUnitMap, u_check);
                     Cell::VisitAllObjects(m_caster, searcher, max_range);
                 }
 
@@ -1940,7 +1967,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                     break;
                 }
 
-                tempTargetUnitMap.sort(TargetDistanceOrderNear(pUnitTarget));
+                std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(pUnitTarget));
 
                 if (*tempTargetUnitMap.begin() == pUnitTarget)
                 {
@@ -1968,7 +1995,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                     prev = *next;
                     targetUnitMap.push_back(prev);
                     tempTargetUnitMap.erase(next);
-                    tempTargetUnitMap.sort(TargetDistanceOrderNear(prev));
+                    std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(prev));
                     next = tempTargetUnitMap.begin();
 
                     --t;
@@ -1989,14 +2016,14 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                     break;
                 default:
                     // Select friendly targets for positive effect
-                    if (IsPositiveEffect(m_spellInfo, effIndex))
+                    if (IsPositiveEffect(m_spellInfo->Id, effIndex))
                     {
                         targetB = SPELL_TARGETS_FRIENDLY;
                     }
                     break;
             }
 
-            UnitList tempTargetUnitMap;
+            PooledUnitList tempTargetUnitMap;
             SQLMultiStorage::SQLMSIteratorBounds<SpellTargetEntry> bounds = sSpellScriptTargetStorage.getBounds<SpellTargetEntry>(m_spellInfo->Id);
 
             // fill real target list if no spell script target defined
@@ -2055,7 +2082,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 break;
             }
 
-            UnitList tempTargetUnitMap;
+            PooledUnitList tempTargetUnitMap;
             SQLMultiStorage::SQLMSIteratorBounds<SpellTargetEntry> bounds = sSpellScriptTargetStorage.getBounds<SpellTargetEntry>(m_spellInfo->Id);
             // fill real target list if no spell script target defined
             FillAreaTargets(bounds.first != bounds.second ? tempTargetUnitMap : targetUnitMap, radius, PUSH_DEST_CENTER, SPELL_TARGETS_ALL);
@@ -2105,7 +2132,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 {
                     if (!(*itr)->IsTargetableForAttack(m_spellInfo->HasAttribute(SPELL_ATTR_EX3_CAST_ON_DEAD)))
                     {
-                        targetUnitMap.erase(itr++);
+                        itr = targetUnitMap.erase(itr);
                     }
                     else
                     {
@@ -2308,7 +2335,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 targetB = SPELL_TARGETS_ALL;
             }
 
-            UnitList tempTargetUnitMap;
+            PooledUnitList tempTargetUnitMap;
             SQLMultiStorage::SQLMSIteratorBounds<SpellTargetEntry> bounds = sSpellScriptTargetStorage.getBounds<SpellTargetEntry>(m_spellInfo->Id);
 
             // fill real target list if no spell script target defined
@@ -2521,16 +2548,16 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                 unMaxTargets = EffectChainTarget;
                 float max_range = radius + unMaxTargets * CHAIN_SPELL_JUMP_RADIUS;
 
-                UnitList tempTargetUnitMap;
+                PooledUnitList tempTargetUnitMap;
 
                 FillAreaTargets(tempTargetUnitMap, max_range, PUSH_SELF_CENTER, SPELL_TARGETS_FRIENDLY);
 
                 if (m_caster != pUnitTarget && std::find(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), m_caster) == tempTargetUnitMap.end())
                 {
-                    tempTargetUnitMap.push_front(m_caster);
+                    tempTargetUnitMap.push_back(m_caster);
                 }
 
-                tempTargetUnitMap.sort(TargetDistanceOrderNear(pUnitTarget));
+                std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(pUnitTarget));
 
                 if (tempTargetUnitMap.empty())
                 {
@@ -2569,7 +2596,7 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
                     prev = *next;
                     targetUnitMap.push_back(prev);
                     tempTargetUnitMap.erase(next);
-                    tempTargetUnitMap.sort(TargetDistanceOrderNear(prev));
+                    std::sort(tempTargetUnitMap.begin(), tempTargetUnitMap.end(), TargetDistanceOrderNear(prev));
                     next = tempTargetUnitMap.begin();
 
                     --t;
@@ -2873,44 +2900,29 @@ void Spell::SetTargetMap(SpellEffectIndex effIndex, uint32 targetMode, UnitList&
 
     if (targetMode != TARGET_SELF && m_spellInfo->HasAttribute(SPELL_ATTR_EX_CANT_TARGET_SELF))
     {
-        targetUnitMap.remove(m_caster);
+        targetUnitMap.erase(std::remove(targetUnitMap.begin(), targetUnitMap.end(), m_caster), targetUnitMap.end());
     }
 
     if (unMaxTargets && targetUnitMap.size() > unMaxTargets)
     {
         // make sure one unit is always removed per iteration
         uint32 removed_utarget = 0;
-        for (UnitList::iterator itr = targetUnitMap.begin(), next; itr != targetUnitMap.end(); itr = next)
+        if (Unit* unitTarget = m_targets.getUnitTarget())
         {
-            next = itr;
-            ++next;
-            if (!*itr)
+            UnitList::iterator newEnd = std::remove(targetUnitMap.begin(), targetUnitMap.end(), unitTarget);
+            if (newEnd != targetUnitMap.end())
             {
-                continue;
-            }
-            if ((*itr) == m_targets.getUnitTarget())
-            {
-                targetUnitMap.erase(itr);
+                targetUnitMap.erase(newEnd, targetUnitMap.end());
                 removed_utarget = 1;
-                //        break;
             }
         }
         // remove random units from the map
         while (targetUnitMap.size() > unMaxTargets - removed_utarget)
         {
-            uint32 poz = urand(0, targetUnitMap.size() - 1);
-            for (UnitList::iterator itr = targetUnitMap.begin(); itr != targetUnitMap.end(); ++itr, --poz)
+            UnitList::iterator itr = targetUnitMap.begin() + urand(0, targetUnitMap.size() - 1);
+            if (*itr)
             {
-                if (!*itr)
-                {
-                    continue;
-                }
-
-                if (!poz)
-                {
-                    targetUnitMap.erase(itr);
-                    break;
-                }
+                targetUnitMap.erase(itr);
             }
         }
         // the player's target will always be added to the map
@@ -4467,7 +4479,7 @@ void Spell::TakePower()
             if (m_caster->GetTypeId() == TYPEID_PLAYER)
             {
                 if (powerType == POWER_ENERGY || powerType == POWER_RAGE)
-                    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                    for (TargetList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                         {
                             if (ihit->missCondition != SPELL_MISS_NONE)
                             {
@@ -5584,7 +5596,7 @@ SpellCastResult Spell::CheckCast(bool strict)
             {
                 if (m_targets.m_targetMask & (TARGET_FLAG_DEST_LOCATION | TARGET_FLAG_SOURCE_LOCATION))
                 {
-                    UnitList targetsCombat;
+                    PooledUnitList targetsCombat;
                     float radius = GetSpellRadius(sSpellRadiusStore.LookupEntry(m_spellInfo->EffectRadiusIndex[i]));
 
                     FillAreaTargets(targetsCombat, radius, PUSH_DEST_CENTER, SPELL_TARGETS_AOE_DAMAGE);
@@ -6025,7 +6037,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                 }
 
                 // check if our map is dungeon
-                if (sMapStore.LookupEntry(m_caster->GetMapId())->IsDungeon())
+                if (sMapColumns.IsDungeon(m_caster->GetMapId()))
                 {
                     InstanceTemplate const* instance = ObjectMgr::GetInstanceTemplate(m_caster->GetMapId());
                     if (m_caster->GetMap() != target->GetMap())
@@ -6252,7 +6264,7 @@ SpellCastResult Spell::CheckCast(bool strict)
                 }
 
                 // Ignore map check if spell have AreaId. AreaId already checked and this prevent special mount spells
-                if (!isAQ40Mounted && m_caster->GetTypeId() == TYPEID_PLAYER && !sMapStore.LookupEntry(m_caster->GetMapId())->IsMountAllowed() && !m_IsTriggeredSpell) //[-ZERO] && !m_spellInfo->AreaId)
+                if (!isAQ40Mounted && m_caster->GetTypeId() == TYPEID_PLAYER && !sMapColumns.IsMountAllowed(m_caster->GetMapId()) && !m_IsTriggeredSpell) //[-ZERO] && !m_spellInfo->AreaId)
                 {
                     return SPELL_FAILED_NO_MOUNTS_ALLOWED;
                 }
@@ -444,7 +444,7 @@ class Spell
         void CleanupTargetList();
         void ClearCastItem();
 
-        typedef std::list<Unit*> UnitList;
+        typedef std::vector<Unit*> UnitList;
 
         void SetSelfContainer(Spell** pCurrentContainer) { m_selfContainer = pCurrentContainer; }
         Spell** GetSelfContainer() { return m_selfContainer; }
@@ -562,9 +562,9 @@ class Spell
             uint8 effectMask;
         };
 
-        typedef std::list<TargetInfo>     TargetList;
-        typedef std::list<GOTargetInfo>   GOTargetList;
-        typedef std::list<ItemTargetInfo> ItemTargetList;
+        typedef std::vector<TargetInfo>     TargetList;
+        typedef std::vector<GOTargetInfo>   GOTargetList;
+        typedef std::vector<ItemTargetInfo> ItemTargetList;
 
         TargetList     m_UniqueTargetInfo;
         GOTargetList   m_UniqueGOTargetInfo;
@@ -608,6 +608,25 @@ class Spell
         SpellEntry const* m_triggeredByAuraSpell;
 };
 
+/**
+ * @brief A Spell::UnitList whose storage comes from a per-thread pool of spare lists.
+ *
+ * Target lists are filled and thrown away several times per cast, this keeps
+ * their capacity around instead of allocating it again. Casts can nest (an
+ * aura removed while targets are filled may cast a triggered spell), so every
+ * user takes a list of its own from the pool rather than sharing one buffer.
+ */
+class PooledUnitList : public Spell::UnitList
+{
+    public:
+        PooledUnitList();
+        ~PooledUnitList();
+
+    private:
+        PooledUnitList(PooledUnitList const&);
+        PooledUnitList& operator=(PooledUnitList const&);
+};
+
 enum ReplenishType
 {
     REPLENISH_UNDEFINED = 0,
@@ -674,6 +693,8 @@ namespace MaNGOS
         float i_centerX;
         float i_centerY;
         float i_centerZ;
+        float i_centerSize;                                 // bounding radius the push check adds for the center object
+        bool i_hasCenter;
 
         float GetCenterX() const { return i_centerX; }
         float GetCenterY() const { return i_centerY; }
@@ -681,7 +702,8 @@ namespace MaNGOS
         SpellNotifierCreatureAndPlayer(Spell& spell, Spell::UnitList& data, float radius, SpellNotifyPushType type,
                                        SpellTargets TargetType = SPELL_TARGETS_NOT_FRIENDLY, WorldObject* originalCaster = NULL)
             : i_data(&data), i_spell(spell), i_push_type(type), i_radius(radius), i_TargetType(TargetType),
-              i_originalCaster(originalCaster), i_castingObject(i_spell.GetCastingObject())
+              i_originalCaster(originalCaster), i_castingObject(i_spell.GetCastingObject()),
+              i_centerX(0.0f), i_centerY(0.0f), i_centerZ(0.0f), i_centerSize(0.0f), i_hasCenter(false)
         {
             if (!i_originalCaster)
             {
@@ -700,6 +722,8 @@ namespace MaNGOS
                     {
                         i_centerX = i_castingObject->GetPositionX();
                         i_centerY = i_castingObject->GetPositionY();
+                        i_centerSize = i_castingObject->GetObjectBoundingRadius();
+                        i_hasCenter = true;
                     }
                     break;
                 case PUSH_DEST_CENTER:
@@ -711,12 +735,15 @@ namespace MaNGOS
                     {
                         i_spell.m_targets.getDestination(i_centerX, i_centerY, i_centerZ);
                     }
+                    i_hasCenter = true;
                     break;
                 case PUSH_TARGET_CENTER:
                     if (Unit* target = i_spell.m_targets.getUnitTarget())
                     {
                         i_centerX = target->GetPositionX();
                         i_centerY = target->GetPositionY();
+                        i_centerSize = target->GetObjectBoundingRadius();
+                        i_hasCenter = true;
                     }
                     break;
                 default:
@@ -724,17 +751,37 @@ namespace MaNGOS
             }
         }
 
-        template<class T> inline void Visit(GridRefManager<T>&  m)
+        // only the unit containers can hold targets, all other object types are skipped unvisited
+        void Visit(PlayerMapType& m) { VisitUnits(m); }
+        void Visit(CreatureMapType& m) { VisitUnits(m); }
+
+        template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) {}
+
+        /// Cheap 2d test that rejects units which cannot pass any push check, done before the faction checks.
+        bool IsInCullRadius(WorldObject const* obj) const
+        {
+            float dx = obj->GetPositionX() - i_centerX;
+            float dy = obj->GetPositionY() - i_centerY;
+            float maxDist = i_radius + i_centerSize + obj->GetObjectBoundingRadius();
+            return dx * dx + dy * dy <= maxDist * maxDist;
+        }
+
+        template<class T> inline void VisitUnits(GridRefManager<T>&  m)
         {
             MANGOS_ASSERT(i_data);
 
-            if (!i_originalCaster || !i_castingObject)
+            if (!i_originalCaster || !i_castingObject || !i_hasCenter)
             {
                 return;
             }
 
             for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
             {
+                if (!IsInCullRadius(itr->getSource()))
+                {
+                    continue;
+                }
+
                 // GM OFF Spell must pass the checks.
                 bool gmSpell = (i_spell.m_spellInfo->Id == 1509);
                 // there are still more spells which can be casted on dead, but
@@ -853,20 +900,6 @@ namespace MaNGOS
             }
         }
 
-#ifdef WIN32
-        template<> inline void Visit(CorpseMapType&) {}
-        template<> inline void Visit(GameObjectMapType&) {}
-        template<> inline void Visit(DynamicObjectMapType&) {}
-        template<> inline void Visit(CameraMapType&) {}
-#endif
-    };
-
-#ifndef WIN32
-    template<> inline void SpellNotifierCreatureAndPlayer::Visit(CorpseMapType&) {}
-    template<> inline void SpellNotifierCreatureAndPlayer::Visit(GameObjectMapType&) {}
-    template<> inline void SpellNotifierCreatureAndPlayer::Visit(DynamicObjectMapType&) {}
-    template<> inline void SpellNotifierCreatureAndPlayer::Visit(CameraMapType&) {}
-#endif
 }
 
 typedef void(Spell::*pEffect)(SpellEffectIndex eff_idx);
@@ -269,7 +269,7 @@ Aura::Aura(SpellEntry const* spellproto, SpellEffectIndex eff, int32* currentBas
 
     m_currentBasePoints = currentBasePoints ? *currentBasePoints : spellproto->CalculateSimpleValue(eff);
 
-    m_positive = IsPositiveEffect(spellproto, m_effIndex);
+    m_positive = IsPositiveEffect(spellproto->Id, m_effIndex);
     m_applyTime = time(NULL);
 
     int32 damage;
@@ -422,7 +422,7 @@ void AreaAura::Update(uint32 diff)
             {
                 owner = caster;
             }
-            Spell::UnitList targets;
+            PooledUnitList targets;
 
             switch (m_areaAuraType)
             {
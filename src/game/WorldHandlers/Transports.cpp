@@ -114,6 +114,7 @@ void MapManager::LoadTransports()
         }
 
         m_Transports.insert(t);
+        t->GetMap()->AddGlobalTransport(t);
 
         ++count;
     }
@@ -659,27 +660,37 @@ void GlobalTransport::Update(uint32 /*update_diff*/, uint32 /*p_time*/)
     m_timer = GameTime::GetGameTimeMS() % m_period;
     while (((m_timer - m_curr->first) % m_pathTime) > ((m_next->first - m_curr->first) % m_pathTime))
     {
-        MoveToNextWayPoint();
-
         // first check help in case client-server transport coordinates de-synchronization
-        if (m_curr->second.mapid != GetMapId() || m_curr->second.teleport)
-        {
-            TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
-        }
-        else
+        if (m_next->second.mapid != GetMapId() || m_next->second.teleport)
         {
-            Relocate(m_curr->second.x, m_curr->second.y, m_curr->second.z);
+            // runs in the map update, passengers can only be moved to other maps after it
+            GetMap()->AddTransportHandoff(this);
+            return;
         }
 
-        m_nextNodeTime = m_curr->first;
+        MoveToNextWayPoint();
+        Relocate(m_curr->second.x, m_curr->second.y, m_curr->second.z);
+        ReachedWayPoint();
+    }
+}
 
-        if (m_curr == m_WayPoints.begin())
-        {
-            DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, " ************ BEGIN ************** %s", GetName());
-        }
+void GlobalTransport::TeleportToNextWayPoint()
+{
+    MoveToNextWayPoint();
+    TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
+    ReachedWayPoint();
+}
+
+void GlobalTransport::ReachedWayPoint()
+{
+    m_nextNodeTime = m_curr->first;
 
-        DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, "%s moved to %f %f %f %d", GetName(), m_curr->second.x, m_curr->second.y, m_curr->second.z, m_curr->second.mapid);
+    if (m_curr == m_WayPoints.begin())
+    {
+        DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, " ************ BEGIN ************** %s", GetName());
     }
+
+    DETAIL_FILTER_LOG(LOG_FILTER_TRANSPORT_MOVES, "%s moved to %f %f %f %d", GetName(), m_curr->second.x, m_curr->second.y, m_curr->second.z, m_curr->second.mapid);
 }
 
 void GlobalTransport::UpdateForMap(Map const* targetMap)
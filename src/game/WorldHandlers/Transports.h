@@ -74,11 +74,15 @@ class GlobalTransport : public Transport
         bool Initialize(uint32 entry, uint32 period, std::string const& name);
         std::set<uint32> const* GetMapsUsed() const { return &m_mapsUsed; }
 
+        /// Moves to a map change or teleport node handed off by Update(), called by MapManager::Update() outside of the map updates.
+        void TeleportToNextWayPoint();
+
     private:
         bool GenerateWaypoints();
         void TeleportTransport(uint32 newMapid, float x, float y, float z);
         void UpdateForMap(Map const* map);
         void MoveToNextWayPoint();                          // move m_next/m_cur to next points
+        void ReachedWayPoint();
 
     private:
         struct WayPoint
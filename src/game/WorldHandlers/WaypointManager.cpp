@@ -71,6 +71,60 @@ WaypointBehavior::WaypointBehavior(const WaypointBehavior& b)
     }
 }
 
+/**
+ * It rebuilds the packed points of the path from its nodes
+ */
+void WaypointPath::Compile()
+{
+    m_points.clear();
+    m_points.reserve(size());
+    for (const_iterator itr = begin(); itr != end(); ++itr)
+    {
+        WaypointPathPoint point;
+        point.pointId = itr->first;
+        point.x = itr->second.x;
+        point.y = itr->second.y;
+        point.z = itr->second.z;
+        point.length = 0.0f;
+        point.passThrough = !itr->second.delay && !itr->second.script_id && !itr->second.behavior;
+        m_points.push_back(point);
+    }
+
+    for (size_t i = 0; i < m_points.size(); ++i)
+    {
+        WaypointPathPoint const& prev = m_points[i ? i - 1 : m_points.size() - 1];
+        float dx = m_points[i].x - prev.x;
+        float dy = m_points[i].y - prev.y;
+        float dz = m_points[i].z - prev.z;
+        m_points[i].length = sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+/**
+ * It finds a point in the packed points, which are sorted by point id
+ * @param pointId The point ID to look for.
+ * @return the index of the point, or the point count if the path doesn't have it.
+ */
+uint32 WaypointPath::GetPointIndex(uint32 pointId) const
+{
+    uint32 lo = 0;
+    uint32 hi = m_points.size();
+    while (lo < hi)
+    {
+        uint32 mid = (lo + hi) / 2;
+        if (m_points[mid].pointId < pointId)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo < m_points.size() && m_points[lo].pointId == pointId ? lo : uint32(m_points.size());
+}
+
 /**
  * It loads the waypoints from the database
  * @return a pointer to a WaypointPath object.
@@ -414,6 +468,16 @@ void WaypointManager::Load()
         sLog.outString();
     }
 
+    for (WaypointPathMap::iterator itr = m_pathMap.begin(); itr != m_pathMap.end(); ++itr)
+    {
+        itr->second.Compile();
+    }
+
+    for (WaypointPathMap::iterator itr = m_pathTemplateMap.begin(); itr != m_pathTemplateMap.end(); ++itr)
+    {
+        itr->second.Compile();
+    }
+
     if (!movementScriptSet.empty())
     {
         for (std::set<uint32>::const_iterator itr = movementScriptSet.begin(); itr != movementScriptSet.end(); ++itr)
@@ -460,6 +524,7 @@ void WaypointManager::_clearPath(WaypointPath& path)
         delete itr->second.behavior;
     }
     path.clear();
+    path.Compile();
 }
 
 /**
@@ -489,7 +554,9 @@ bool WaypointManager::AddExternalNode(uint32 entry, int32 pathId, uint32 pointId
         return false;
     }
 
-    m_externalPathTemplateMap[(entry << 8) + pathId][pointId] = WaypointNode(x, y, z, o, waittime, 0, NULL);
+    WaypointPath& path = m_externalPathTemplateMap[(entry << 8) + pathId];
+    path[pointId] = WaypointNode(x, y, z, o, waittime, 0, NULL);
+    path.Compile();
     return true;
 }
 
@@ -558,6 +625,7 @@ WaypointNode const* WaypointManager::AddNode(uint32 entry, uint32 dbGuid, uint32
     // Insert new Point to database
     WorldDatabase.PExecuteLog("INSERT INTO `%s` (`%s`,`point`,`position_x`,`position_y`,`position_z`,`orientation`) VALUES (%u,%u, %f,%f,%f, 100)", table, key_field, key, pointId, x, y, z);
 
+    path.Compile();
     return &path[pointId];
 }
 
@@ -590,6 +658,7 @@ void WaypointManager::DeleteNode(uint32 entry, uint32 dbGuid, uint32 point, int3
     WorldDatabase.PExecuteLog("DELETE FROM `%s` WHERE `%s`=%u AND `point`=%u", table, key_field, key, point);
 
     path->erase(point);
+    path->Compile();
 }
 
 /**
@@ -648,6 +717,7 @@ void WaypointManager::SetNodePosition(uint32 entry, uint32 dbGuid, uint32 point,
         find->second.x = x;
         find->second.y = y;
         find->second.z = z;
+        path->Compile();
     }
 }
 
@@ -685,6 +755,7 @@ void WaypointManager::SetNodeWaittime(uint32 entry, uint32 dbGuid, uint32 point,
     if (find != path->end())
     {
         find->second.delay = waittime;
+        path->Compile();
     }
 }
 
@@ -758,6 +829,7 @@ bool WaypointManager::SetNodeScriptId(uint32 entry, uint32 dbGuid, uint32 point,
     if (find != path->end())
     {
         find->second.script_id = scriptId;
+        path->Compile();
     }
 
     ScriptChainMap const* scm = sScriptMgr.GetScriptChainMap(DBS_ON_CREATURE_MOVEMENT);
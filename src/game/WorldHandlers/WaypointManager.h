@@ -28,6 +28,8 @@
 #include "Common.h"
 #include "Utilities/UnorderedMapSet.h"
 
+#include <vector>
+
 enum WaypointPathOrigin
 {
     PATH_NO_PATH            = 0,
@@ -75,7 +77,39 @@ struct WaypointNode
         : x(_x), y(_y), z(_z), orientation(_o), delay(_delay), script_id(_script_id), behavior(_behavior) {}
 };
 
-typedef std::map < uint32 /*pointId*/, WaypointNode > WaypointPath;
+/// Packed copy of a path node, read by the waypoint movement generator
+struct WaypointPathPoint
+{
+    uint32 pointId;
+    float x;
+    float y;
+    float z;
+    float length;                                           // from the previous point, from the last point for the first one
+    bool passThrough;                                       // no delay, script or behavior, a spline may run through it
+};
+
+typedef std::vector<WaypointPathPoint> WaypointPathPoints;
+
+/**
+ * @brief Nodes of a waypoint path by point id.
+ *
+ * Next to the node map, which the .wp commands edit, a path keeps its nodes
+ * packed into one array in point order with the segment lengths computed up
+ * front, shared by all creatures walking the path. The manager rebuilds it
+ * with Compile() whenever it changes the nodes.
+ */
+class WaypointPath : public std::map < uint32 /*pointId*/, WaypointNode >
+{
+    public:
+        void Compile();
+
+        WaypointPathPoints const& GetPoints() const { return m_points; }
+        /// Index of pointId in GetPoints(), GetPoints().size() if the path doesn't have it
+        uint32 GetPointIndex(uint32 pointId) const;
+
+    private:
+        WaypointPathPoints m_points;
+};
 
 class WaypointManager
 {
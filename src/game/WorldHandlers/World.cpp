@@ -57,6 +57,7 @@
 #include "VMapFactory.h"
 #include "MoveMap.h"
 #include "GameEventMgr.h"
+#include "NameLookupIndex.h"
 #include "PoolManager.h"
 #include "Database/DatabaseImpl.h"
 #include "GridNotifiersImpl.h"
@@ -67,6 +68,7 @@
 #include "Util.h"
 #include "AuctionHouseBot/AuctionHouseBot.h"
 #include "CharacterDatabaseCleaner.h"
+#include "CharacterDirectory.h"
 #include "CreatureLinkingMgr.h"
 #include "Weather.h"
 #include "LFGMgr.h"
@@ -75,6 +77,7 @@
 #include "CommandMgr.h"
 #include "GitRevision.h"
 #include "UpdateTime.h"
+#include "TickProfiler.h"
 #include "GameTime.h"
 
 #ifdef ENABLE_ELUNA
@@ -559,6 +562,12 @@ void World::LoadConfigSettings(bool reload)
     {
         sMapMgr.SetGridCleanUpDelay(getConfig(CONFIG_UINT32_INTERVAL_GRIDCLEAN));
     }
+    setConfig(CONFIG_UINT32_GRID_HIBERNATE_TIME, "GridHibernateTime", 0);
+
+    setConfigMin(CONFIG_UINT32_UPDATE_LOD_MID_INTERVAL, "UpdateLOD.MidInterval", 2, 1);
+    setConfigMin(CONFIG_UINT32_UPDATE_LOD_FAR_INTERVAL, "UpdateLOD.FarInterval", 4, 1);
+    setConfigMin(CONFIG_FLOAT_UPDATE_LOD_NEAR_DISTANCE, "UpdateLOD.NearDistance", 40.0f, 0.0f);
+    setConfigMin(CONFIG_FLOAT_UPDATE_LOD_MID_DISTANCE, "UpdateLOD.MidDistance", 70.0f, getConfig(CONFIG_FLOAT_UPDATE_LOD_NEAR_DISTANCE));
 
     setConfig(CONFIG_UINT32_NUMTHREADS, "MapUpdateThreads", 2);
 
@@ -681,7 +690,8 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
-    setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 100, 1);
+    setConfig(CONFIG_UINT32_GAME_EVENT_UPDATE_BUDGET, "Event.UpdateBudget", 5);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -958,6 +968,8 @@ void World::LoadConfigSettings(bool reload)
     MMAP::MMapFactory::preventPathfindingOnMaps(ignoreMapIds.c_str());
     sLog.outString("WORLD: MMap pathfinding %sabled", getConfig(CONFIG_BOOL_MMAP_ENABLED) ? "en" : "dis");
 
+    sTickProfiler.LoadFromConfig();
+
 #ifdef ENABLE_ELUNA
     if (reload)
     {
@@ -1269,6 +1281,9 @@ void World::SetInitialWorldSettings()
     CharacterDatabaseCleaner::CleanDatabase();
     sLog.outString();
 
+    sLog.outString("Loading Character Directory...");
+    sCharacterDirectory.LoadFromDB();
+
     sLog.outString("Loading the max pet number...");
     sObjectMgr.LoadPetNumber();
 
@@ -1337,6 +1352,10 @@ void World::SetInitialWorldSettings()
     sLog.outString(">>> Localization strings loaded");
     sLog.outString();
 
+    sLog.outString("Indexing template names for lookup commands...");
+    sNameLookupMgr.LoadAll();                               // must be after templates, Spell.dbc and their locales
+    sLog.outString();
+
     ///- Load dynamic data tables from the database
     sLog.outString("Loading Auctions...");
     sAuctionMgr.LoadAuctionItems();
@@ -1679,6 +1698,8 @@ void World::DetectDBCLang()
 /// Update the World !
 void World::Update(uint32 diff)
 {
+    PerfScope perfScope(PERF_WORLD_UPDATE);
+
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
     {
@@ -1714,10 +1735,14 @@ void World::Update(uint32 diff)
     _UpdateGameTime();
     GameTime::UpdateGameTimers();
     sWorldUpdateTime.UpdateWithDiff(diff);
+    sTickProfiler.Update(diff);
 
     ///-Update mass mailer tasks if any
     sMassMailMgr.Update();
 
+    ///- Spawn/despawn steps of started and stopped game events if any
+    sGameEventMgr.UpdateSteps();
+
     /// <ul><li> Handle auctions when the timer has passed
     if (m_timers[WUPDATE_AUCTIONS].Passed())
     {
@@ -1748,7 +1773,10 @@ void World::Update(uint32 diff)
 #endif
 
     /// <li> Handle session updates
-    UpdateSessions(diff);
+    {
+        PerfScope perfSessions(PERF_WORLD_SESSIONS);
+        UpdateSessions(diff);
+    }
 
     /// <li> Update uptime table
     if (m_timers[WUPDATE_UPTIME].Passed())
@@ -1762,7 +1790,10 @@ void World::Update(uint32 diff)
 
     /// <li> Handle all other objects
     ///- Update objects (maps, transport, creatures,...)
-    sMapMgr.Update(diff);
+    {
+        PerfScope perfMaps(PERF_WORLD_MAPS);
+        sMapMgr.Update(diff);
+    }
     sBattleGroundMgr.Update(diff);
     sLFGMgr.Update(diff);
     sOutdoorPvPMgr.Update(diff);
@@ -1784,7 +1815,10 @@ void World::Update(uint32 diff)
     }
 
     // execute callbacks from sql queries that were queued recently
-    UpdateResultQueue();
+    {
+        PerfScope perfResults(PERF_WORLD_RESULT_QUEUE);
+        UpdateResultQueue();
+    }
 
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
@@ -91,6 +91,9 @@ enum eConfigUInt32Values
     CONFIG_UINT32_COMPRESSION = 0,
     CONFIG_UINT32_INTERVAL_SAVE,
     CONFIG_UINT32_INTERVAL_GRIDCLEAN,
+    CONFIG_UINT32_GRID_HIBERNATE_TIME,
+    CONFIG_UINT32_UPDATE_LOD_MID_INTERVAL,
+    CONFIG_UINT32_UPDATE_LOD_FAR_INTERVAL,
     CONFIG_UINT32_INTERVAL_MAPUPDATE,
     CONFIG_UINT32_INTERVAL_CHANGEWEATHER,
     CONFIG_UINT32_PORT_WORLD,
@@ -141,6 +144,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GROUP_VISIBILITY,
     CONFIG_UINT32_MAIL_DELIVERY_DELAY,
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
+    CONFIG_UINT32_GAME_EVENT_UPDATE_BUDGET,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_RATE_MINING_LOWER,
@@ -293,6 +297,8 @@ enum eConfigFloatValues
     CONFIG_FLOAT_THREAT_RADIUS,
     CONFIG_FLOAT_GHOST_RUN_SPEED_WORLD,
     CONFIG_FLOAT_GHOST_RUN_SPEED_BG,
+    CONFIG_FLOAT_UPDATE_LOD_NEAR_DISTANCE,
+    CONFIG_FLOAT_UPDATE_LOD_MID_DISTANCE,
 #ifdef ENABLE_PLAYERBOTS
     CONFIG_FLOAT_PLAYERBOT_MINDISTANCE,
     CONFIG_FLOAT_PLAYERBOT_MAXDISTANCE,
@@ -713,14 +719,14 @@ class World
         static uint32 m_relocation_ai_notify_delay;
 
         // CLI command holder to be thread safe
-        ACE_Based::LockedQueue<CliCommandHolder*, ACE_Thread_Mutex> cliCmdQueue;
+        ACE_Based::MPSCQueue<CliCommandHolder*> cliCmdQueue;
 
         // Player Queue
         Queue m_QueuedSessions;
 
         // sessions that are added async
         void AddSession_(WorldSession* s);
-        ACE_Based::LockedQueue<WorldSession*, ACE_Thread_Mutex> addSessQueue;
+        ACE_Based::MPSCQueue<WorldSession*> addSessQueue;
 
         // used versions
         std::string m_DBVersion;
@@ -191,6 +191,7 @@ namespace Movement
         m_Id = args.splineId;
         point_Idx_offset = args.path_Idx_offset;
         time_passed = 0;
+        m_createCache.clear();
 
         // detect Stop command
         if (splineflags.done)
@@ -113,6 +113,12 @@ namespace Movement
             int32           point_Idx; /**< Current point index in the spline. */
             int32           point_Idx_offset; /**< Offset for the point index. */
 
+            /**
+             * @brief Create block bytes from the duration on, the same for every viewer of this spline.
+             * Written by PacketBuilder::WriteCreate for the first viewer, cleared by Initialize().
+             */
+            mutable std::vector<uint8> m_createCache;
+
             /**
              * @brief Initializes the spline with the given arguments.
              * @param args The arguments for initializing the spline.
@@ -109,7 +109,8 @@ namespace Movement
         unit.m_movementInfo.SetMovementFlags((MovementFlags)moveFlags);
         move_spline.Initialize(args);
 
-        WorldPacket data(SMSG_MONSTER_MOVE, 64);
+        // one packet for all receivers, the sockets copy it straight into their output buffers
+        WorldPacket data(SMSG_MONSTER_MOVE, 64 + args.path.size() * sizeof(Vector3));
         data << unit.GetPackGUID();
         PacketBuilder::WriteMonsterMove(move_spline, data);
         unit.SendMessageToSet(&data, true);
@@ -187,12 +187,21 @@ namespace Movement
         }
 
         data << move_spline.timePassed();
-        data << move_spline.Duration();
-        data << move_spline.GetId();
 
-        uint32 nodes = move_spline.getPath().size();
-        data << nodes;
-        data.append<Vector3>(&move_spline.getPath()[0], nodes);
-        data << (move_spline.isCyclic() ? Vector3::zero() : move_spline.FinalDestination());
+        // the rest doesn't change while the spline runs, serialize it once for all viewers
+        std::vector<uint8>& cache = move_spline.m_createCache;
+        if (cache.empty())
+        {
+            uint32 nodes = move_spline.getPath().size();
+            ByteBuffer tail(4 + 4 + 4 + (nodes + 1) * sizeof(Vector3));
+            tail << move_spline.Duration();
+            tail << move_spline.GetId();
+            tail << nodes;
+            tail.append<Vector3>(&move_spline.getPath()[0], nodes);
+            tail << (move_spline.isCyclic() ? Vector3::zero() : move_spline.FinalDestination());
+            cache.assign(tail.contents(), tail.contents() + tail.size());
+        }
+
+        data.append(&cache[0], cache.size());
     }
 }
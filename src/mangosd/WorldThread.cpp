@@ -43,6 +43,10 @@
 #include "LuaEngine.h"
 #endif /* ENABLE_ELUNA */
 
+#ifdef ENABLE_PLAYERBOTS
+#include "RandomPlayerbotMgr.h"
+#endif
+
 #define WORLD_SLEEP_CONST 50
 
 #ifdef WIN32
@@ -105,6 +109,9 @@ int WorldThread::svc()
     }
     sWorld.KickAll();                                       // save and kick all players
     sWorld.UpdateSessions(1);                               // real players unload required UpdateSessions call
+#ifdef ENABLE_PLAYERBOTS
+    sRandomPlayerbotMgr.SaveEventValues();                  // random bot events changed since the last bot update
+#endif
     sWorldSocketMgr->StopNetwork();
 
     sMapMgr.UnloadAll();                                    // unload all grids (including locked in memory)
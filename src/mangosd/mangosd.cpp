@@ -47,6 +47,7 @@
 #include "Util.h"
 #include "DBCStores.h"
 #include "MassMailMgr.h"
+#include "PlayerDump.h"
 #include "ScriptMgr.h"
 
 #include "WorldThread.h"
@@ -124,6 +125,7 @@ static bool start_db()
 
     dbstring = sConfig.GetStringDefault("CharacterDatabaseInfo", "");
     nConnections = sConfig.GetIntDefault("CharacterDatabaseConnections", 1);
+    int nHolderConnections = sConfig.GetIntDefault("CharacterDatabaseHolderConnections", 0);
     if (dbstring.empty())
     {
         sLog.outError("Character Database not specified in configuration file");
@@ -132,10 +134,10 @@ static bool start_db()
         WorldDatabase.HaltDelayThread();
         return false;
     }
-    sLog.outString("Character Database total connections: %i", nConnections + 1);
+    sLog.outString("Character Database total connections: %i", nConnections + nHolderConnections + 1);
 
     ///- Initialise the Character database
-    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections))
+    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections, nHolderConnections))
     {
         sLog.outError("Can not connect to Character database %s", dbstring.c_str());
 
@@ -589,6 +591,9 @@ int main(int argc, char** argv)
     // send all still queued mass mails (before DB connections shutdown)
     sMassMailMgr.Update(true);
 
+    // finish a running .pdump writeall (before DB connections shutdown)
+    PlayerDumpWriter::WaitDumps();
+
     ///- Wait for DB delay threads to end
     CharacterDatabase.HaltDelayThread();
     WorldDatabase.HaltDelayThread();
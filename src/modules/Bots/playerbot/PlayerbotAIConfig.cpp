@@ -196,6 +196,8 @@ bool PlayerbotAIConfig::Initialize()
     }
 
     CreateRandomBots();
+    sRandomPlayerbotMgr.LoadEventValues();
+    sRandomPlayerbotMgr.LoadTeleportLocations();
     sLog.outString("AI Playerbot configuration loaded");
 
     return true;
@@ -101,6 +101,8 @@ void RandomPlayerbotMgr::UpdateAIInternal(uint32 elapsed)
     {
         PrintStats();
     }
+
+    SaveEventValues();
 }
 
 uint32 RandomPlayerbotMgr::AddRandomBot(bool alliance)
@@ -291,54 +293,130 @@ void RandomPlayerbotMgr::RandomTeleport(Player* bot, vector<WorldLocation> &locs
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
 {
-    vector<WorldLocation> locs;
-    QueryResult* results = WorldDatabase.PQuery("SELECT `map`, `position_x`, `position_y`, `position_z` FROM ("
-        "SELECT MIN(`c`.`map`) `map`, MIN(`c`.`position_x`) `position_x`, MIN(`c`.`position_y`) `position_y`, "
-    "MIN(`c`.`position_z`) `position_z`, AVG(`t`.`maxlevel`), AVG(`t`.`minlevel`), "
-        "%u - (AVG(`t`.`maxlevel`) + AVG(`t`.`minlevel`)) / 2 `delta` FROM `creature` `c` "
-    "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` GROUP BY `t`.`entry`) `q` "
-        "WHERE `delta` >= 0 AND `delta` <= %u AND `map` IN (%s)",
-
-        bot->getLevel(), sPlayerbotAIConfig.randomBotTeleLevel, sPlayerbotAIConfig.randomBotMapsAsString.c_str());
-    if (results)
+    uint32 level = bot->getLevel();
+    if (level >= levelLocations.size())
     {
-        do
-        {
-            Field* fields = results->Fetch();
-            uint32 mapId = fields[0].GetUInt32();
-            float x = fields[1].GetFloat();
-            float y = fields[2].GetFloat();
-            float z = fields[3].GetFloat();
-            WorldLocation loc(mapId, x, y, z, 0);
-            locs.push_back(loc);
-        } while (results->NextRow());
-        delete results;
+        sLog.outError("Cannot teleport bot %s - no locations available", bot->GetName());
+        return;
     }
 
-    RandomTeleport(bot, locs);
+    RandomTeleport(bot, levelLocations[level]);
 }
 
 void RandomPlayerbotMgr::RandomTeleport(Player* bot, uint32 mapId, float teleX, float teleY, float teleZ)
 {
+    vector<RandomBotSpawnPoint const*> points;
+    GetSpawnPointsNear(mapId, teleX, teleY, points);
+
     vector<WorldLocation> locs;
-    QueryResult* results = WorldDatabase.PQuery("SELECT `position_x`, `position_y`, `position_z` FROM `creature` WHERE `map` = '%u' AND ABS(`position_x` - '%f') < '%u' AND ABS(`position_y` - '%f') < '%u'",
-            mapId, teleX, sPlayerbotAIConfig.randomBotTeleportDistance / 2, teleY, sPlayerbotAIConfig.randomBotTeleportDistance / 2);
+    locs.reserve(points.size());
+    for (vector<RandomBotSpawnPoint const*>::const_iterator i = points.begin(); i != points.end(); ++i)
+    {
+        locs.push_back(WorldLocation(mapId, (*i)->x, (*i)->y, (*i)->z, 0));
+    }
+
+    RandomTeleport(bot, locs);
+    Refresh(bot);
+}
+
+/**
+ * Spawn points are bucketed in square cells of randomBotTeleportDistance, so the
+ * +/- randomBotTeleportDistance / 2 box around a point never spans more than the
+ * 3x3 cells around it.
+ */
+static uint32 GetSpawnCellKey(int32 cellX, int32 cellY)
+{
+    return (uint32(cellX + 0x8000) << 16) | uint32((cellY + 0x8000) & 0xFFFF);
+}
+
+static int32 GetSpawnCellCoord(float coord)
+{
+    float cellSize = float(std::max(sPlayerbotAIConfig.randomBotTeleportDistance, 1u));
+    return int32(floor(coord / cellSize));
+}
+
+void RandomPlayerbotMgr::LoadTeleportLocations()
+{
+    uint32 maxLevel = sWorld.getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL);
+    levelLocations.assign(maxLevel + 1, vector<WorldLocation>());
+
+    set<uint32> botMaps(sPlayerbotAIConfig.randomBotMaps.begin(), sPlayerbotAIConfig.randomBotMaps.end());
+    set<uint32> templatesPlaced;
+    uint32 count = 0;
+
+    QueryResult* results = WorldDatabase.Query("SELECT `id`, `map`, `position_x`, `position_y`, `position_z` FROM `creature`");
     if (results)
     {
         do
         {
             Field* fields = results->Fetch();
-            float x = fields[0].GetFloat();
-            float y = fields[1].GetFloat();
-            float z = fields[2].GetFloat();
-            WorldLocation loc(mapId, x, y, z, 0);
-            locs.push_back(loc);
+            uint32 entry = fields[0].GetUInt32();
+            uint32 mapId = fields[1].GetUInt32();
+
+            CreatureInfo const* cInfo = ObjectMgr::GetCreatureTemplate(entry);
+            if (!cInfo)
+            {
+                continue;
+            }
+
+            RandomBotSpawnPoint point;
+            point.x = fields[2].GetFloat();
+            point.y = fields[3].GetFloat();
+            point.z = fields[4].GetFloat();
+            point.minLevel = cInfo->MinLevel;
+            point.maxLevel = cInfo->MaxLevel;
+
+            spawnGrid[mapId][GetSpawnCellKey(GetSpawnCellCoord(point.x), GetSpawnCellCoord(point.y))].push_back(point);
+            ++count;
+
+            // bots of level L grind at templates whose average level lies in [L - randomBotTeleLevel, L]
+            if (botMaps.find(mapId) == botMaps.end() || !templatesPlaced.insert(entry).second)
+            {
+                continue;
+            }
+
+            float avgLevel = (cInfo->MinLevel + cInfo->MaxLevel) / 2.0f;
+            for (uint32 level = uint32(ceil(avgLevel)); level <= maxLevel && level <= avgLevel + sPlayerbotAIConfig.randomBotTeleLevel; ++level)
+            {
+                levelLocations[level].push_back(WorldLocation(mapId, point.x, point.y, point.z, 0));
+            }
         } while (results->NextRow());
         delete results;
     }
 
-    RandomTeleport(bot, locs);
-    Refresh(bot);
+    sLog.outString("Loaded %u creature spawn points for random bot teleports", count);
+}
+
+void RandomPlayerbotMgr::GetSpawnPointsNear(uint32 mapId, float teleX, float teleY, vector<RandomBotSpawnPoint const*>& points)
+{
+    SpawnGrid::const_iterator mapItr = spawnGrid.find(mapId);
+    if (mapItr == spawnGrid.end())
+    {
+        return;
+    }
+
+    float range = sPlayerbotAIConfig.randomBotTeleportDistance / 2;
+    int32 cellX = GetSpawnCellCoord(teleX);
+    int32 cellY = GetSpawnCellCoord(teleY);
+    for (int32 dx = -1; dx <= 1; ++dx)
+    {
+        for (int32 dy = -1; dy <= 1; ++dy)
+        {
+            SpawnCellMap::const_iterator cellItr = mapItr->second.find(GetSpawnCellKey(cellX + dx, cellY + dy));
+            if (cellItr == mapItr->second.end())
+            {
+                continue;
+            }
+
+            for (vector<RandomBotSpawnPoint>::const_iterator i = cellItr->second.begin(); i != cellItr->second.end(); ++i)
+            {
+                if (fabs(i->x - teleX) < range && fabs(i->y - teleY) < range)
+                {
+                    points.push_back(&*i);
+                }
+            }
+        }
+    }
 }
 
 void RandomPlayerbotMgr::Randomize(Player* bot)
@@ -429,27 +507,31 @@ uint32 RandomPlayerbotMgr::GetZoneLevel(uint32 mapId, float teleX, float teleY,
 {
     uint32 maxLevel = sWorld.getConfig(CONFIG_UINT32_MAX_PLAYER_LEVEL);
 
-    uint32 level;
-    QueryResult *results = WorldDatabase.PQuery("SELECT AVG(`t`.`minlevel`) `minlevel`, AVG(`t`.`maxlevel`) `maxlevel` FROM `creature` `c` "
-            "INNER JOIN `creature_template` `t` ON `c`.`id` = `t`.`entry` "
-            "WHERE `map` = '%u' AND `minlevel` > 1 AND ABS(`position_x` - '%f') < '%u' AND ABS(`position_y` - '%f') < '%u'",
-            mapId, teleX, sPlayerbotAIConfig.randomBotTeleportDistance / 2, teleY, sPlayerbotAIConfig.randomBotTeleportDistance / 2);
+    vector<RandomBotSpawnPoint const*> points;
+    GetSpawnPointsNear(mapId, teleX, teleY, points);
 
-    if (results)
+    uint32 minLevelSum = 0, maxLevelSum = 0, count = 0;
+    for (vector<RandomBotSpawnPoint const*>::const_iterator i = points.begin(); i != points.end(); ++i)
     {
-        Field* fields = results->Fetch();
-        uint32 minLevel = fields[0].GetUInt32();
-        uint32 maxLevel = fields[1].GetUInt32();
-        level = urand(minLevel, maxLevel);
-        if (level > maxLevel)
+        if ((*i)->minLevel > 1)
         {
-            level = maxLevel;
+            minLevelSum += (*i)->minLevel;
+            maxLevelSum += (*i)->maxLevel;
+            ++count;
         }
-        delete results;
     }
-    else
+
+    if (!count)
+    {
+        return urand(1, maxLevel);
+    }
+
+    uint32 minLevel = minLevelSum / count;
+    uint32 zoneMaxLevel = maxLevelSum / count;
+    uint32 level = urand(minLevel, zoneMaxLevel);
+    if (level > zoneMaxLevel)
     {
-        level = urand(1, maxLevel);
+        level = zoneMaxLevel;
     }
 
     return level;
@@ -511,21 +593,15 @@ bool RandomPlayerbotMgr::IsRandomBot(uint32 bot)
 
 list<uint32> RandomPlayerbotMgr::GetBots()
 {
-    list<uint32> bots;
+    std::lock_guard<std::mutex> guard(eventLock);
 
-    // Query the database to get the list of random bots
-    QueryResult* results = CharacterDatabase.Query(
-            "SELECT `bot` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `event` = 'add'");
-
-    if (results)
+    list<uint32> bots;
+    for (EventValueCache::const_iterator i = eventValues.begin(); i != eventValues.end(); ++i)
     {
-        do
+        if (i->second.find("add") != i->second.end())
         {
-            Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.push_back(bot);
-        } while (results->NextRow());
-        delete results;
+            bots.push_back(i->first);
+        }
     }
 
     return bots;
@@ -533,22 +609,8 @@ list<uint32> RandomPlayerbotMgr::GetBots()
 
 vector<uint32> RandomPlayerbotMgr::GetFreeBots(bool alliance)
 {
-    set<uint32> bots;
-
-    QueryResult* results = CharacterDatabase.PQuery(
-        "SELECT `bot` FROM `ai_playerbot_random_bots` WHERE `event` = 'add'"
-    );
-
-    if (results)
-    {
-        do
-        {
-            Field* fields = results->Fetch();
-            uint32 bot = fields[0].GetUInt32();
-            bots.insert(bot);
-        } while (results->NextRow());
-        delete results;
-    }
+    list<uint32> botList = GetBots();
+    set<uint32> bots(botList.begin(), botList.end());
 
     vector<uint32> guids;
     for (list<uint32>::iterator i = sPlayerbotAIConfig.randomBotAccounts.begin(); i != sPlayerbotAIConfig.randomBotAccounts.end(); i++)
@@ -582,47 +644,202 @@ vector<uint32> RandomPlayerbotMgr::GetFreeBots(bool alliance)
     return guids;
 }
 
-uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string event)
+void RandomPlayerbotMgr::LoadEventValues()
 {
-    uint32 value = 0;
+    QueryResult* results = CharacterDatabase.Query(
+            "SELECT `bot`, `event`, `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0");
 
-    // Query the database to get the event value for the specified bot
-    QueryResult* results = CharacterDatabase.PQuery(
-            "SELECT `value`, `time`, `validIn` FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND `bot` = '%u' AND `event` = '%s'",
-            bot, event.c_str());
+    std::lock_guard<std::mutex> guard(eventLock);
+    eventValues.clear();
+    dirtyEvents.clear();
 
+    uint32 count = 0;
     if (results)
     {
-        Field* fields = results->Fetch();
-        value = fields[0].GetUInt32();
-        uint32 lastChangeTime = fields[1].GetUInt32();
-        uint32 validIn = fields[2].GetUInt32();
-        if ((time(0) - lastChangeTime) >= validIn)
+        do
         {
-            value = 0;
-        }
+            Field* fields = results->Fetch();
+            RandomBotEvent& entry = eventValues[fields[0].GetUInt32()][fields[1].GetCppString()];
+            entry.value = fields[2].GetUInt32();
+            entry.lastChangeTime = fields[3].GetUInt32();
+            entry.validIn = fields[4].GetUInt32();
+            ++count;
+        } while (results->NextRow());
         delete results;
     }
 
-    return value;
+    sLog.outString("Loaded %u random bot event values", count);
+}
+
+uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, string event)
+{
+    std::lock_guard<std::mutex> guard(eventLock);
+
+    EventValueCache::const_iterator botItr = eventValues.find(bot);
+    if (botItr == eventValues.end())
+    {
+        return 0;
+    }
+
+    BotEventMap::const_iterator eventItr = botItr->second.find(event);
+    if (eventItr == botItr->second.end())
+    {
+        return 0;
+    }
+
+    RandomBotEvent const& entry = eventItr->second;
+    if ((time(0) - entry.lastChangeTime) >= entry.validIn)
+    {
+        return 0;
+    }
+
+    return entry.value;
 }
 
 uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, string event, uint32 value, uint32 validIn)
 {
-    // Delete the existing event value for the specified bot
-    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 and `bot` = '%u' and `event` = '%s'",
-            bot, event.c_str());
+    std::lock_guard<std::mutex> guard(eventLock);
+
     if (value)
     {
-        // Insert the new event value for the specified bot
-        CharacterDatabase.PExecute(
-                "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES ('%u', '%u', '%u', '%u', '%s', '%u')",
-                0, bot, (uint32)time(0), validIn, event.c_str(), value);
+        RandomBotEvent& entry = eventValues[bot][event];
+        entry.value = value;
+        entry.lastChangeTime = (uint32)time(0);
+        entry.validIn = validIn;
+    }
+    else
+    {
+        EventValueCache::iterator botItr = eventValues.find(bot);
+        if (botItr != eventValues.end())
+        {
+            botItr->second.erase(event);
+            if (botItr->second.empty())
+            {
+                eventValues.erase(botItr);
+            }
+        }
     }
 
+    dirtyEvents.insert(make_pair(bot, event));
     return value;
 }
 
+void RandomPlayerbotMgr::SetEventValidIn(uint32 bot, string event, uint32 validIn)
+{
+    std::lock_guard<std::mutex> guard(eventLock);
+
+    EventValueCache::iterator botItr = eventValues.find(bot);
+    if (botItr == eventValues.end())
+    {
+        return;
+    }
+
+    BotEventMap::iterator eventItr = botItr->second.find(event);
+    if (eventItr == botItr->second.end())
+    {
+        return;
+    }
+
+    eventItr->second.validIn = validIn;
+    dirtyEvents.insert(make_pair(bot, event));
+}
+
+void RandomPlayerbotMgr::SaveEventValues()
+{
+    // Statements are built under the lock and run after it is released
+    vector<string> deletes, inserts;
+    uint32 count;
+    {
+        std::lock_guard<std::mutex> guard(eventLock);
+        if (dirtyEvents.empty())
+        {
+            return;
+        }
+
+        // No SQL injection (event names are internal constants)
+        std::ostringstream erase, insert;
+        uint32 erased = 0, inserted = 0;
+        for (DirtyEventSet::const_iterator i = dirtyEvents.begin(); i != dirtyEvents.end(); ++i)
+        {
+            uint32 bot = i->first;
+            string const& event = i->second;
+
+            erase << (erased ? "," : "DELETE FROM `ai_playerbot_random_bots` WHERE `owner` = 0 AND (`bot`, `event`) IN (")
+                  << "('" << bot << "','" << event << "')";
+
+            if (++erased == 100)
+            {
+                erase << ")";
+                deletes.push_back(erase.str());
+                erase.str("");
+                erased = 0;
+            }
+
+            EventValueCache::const_iterator botItr = eventValues.find(bot);
+            if (botItr == eventValues.end())
+            {
+                continue;
+            }
+
+            BotEventMap::const_iterator eventItr = botItr->second.find(event);
+            if (eventItr == botItr->second.end())
+            {
+                continue;
+            }
+
+            RandomBotEvent const& entry = eventItr->second;
+            insert << (inserted ? "," : "INSERT INTO `ai_playerbot_random_bots` (`owner`, `bot`, `time`, `validIn`, `event`, `value`) VALUES ")
+                   << "('0','" << bot << "','" << entry.lastChangeTime << "','" << entry.validIn << "','" << event << "','" << entry.value << "')";
+
+            if (++inserted == 100)
+            {
+                inserts.push_back(insert.str());
+                insert.str("");
+                inserted = 0;
+            }
+        }
+
+        if (erased)
+        {
+            erase << ")";
+            deletes.push_back(erase.str());
+        }
+
+        if (inserted)
+        {
+            inserts.push_back(insert.str());
+        }
+
+        count = uint32(dirtyEvents.size());
+        dirtyEvents.clear();
+    }
+
+    // All deletes run before any insert, the chunks of the two do not line up
+    CharacterDatabase.BeginTransaction();
+    for (vector<string>::const_iterator i = deletes.begin(); i != deletes.end(); ++i)
+    {
+        CharacterDatabase.Execute(i->c_str());
+    }
+    for (vector<string>::const_iterator i = inserts.begin(); i != inserts.end(); ++i)
+    {
+        CharacterDatabase.Execute(i->c_str());
+    }
+    CharacterDatabase.CommitTransaction();
+
+    sLog.outDetail("Saved %u random bot event values", count);
+}
+
+void RandomPlayerbotMgr::ResetEventValues()
+{
+    {
+        std::lock_guard<std::mutex> guard(eventLock);
+        eventValues.clear();
+        dirtyEvents.clear();
+    }
+
+    CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots`");
+}
+
 bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
 {
     if (!sPlayerbotAIConfig.enabled)
@@ -643,7 +860,7 @@ bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
     if (cmd == "reset")
     {
         // Reset all random bots
-        CharacterDatabase.PExecute("DELETE FROM `ai_playerbot_random_bots`");
+        sRandomPlayerbotMgr.ResetEventValues();
         sLog.outBasic("Random bots were reset for all players");
         return true;
     }
@@ -691,15 +908,14 @@ bool ChatHandler::HandlePlayerbotConsoleCommand(char* args)
                         sRandomPlayerbotMgr.IncreaseLevel(bot);
                     }
                     uint32 randomTime = urand(sPlayerbotAIConfig.minRandomBotRandomizeTime, sPlayerbotAIConfig.maxRandomBotRandomizeTime);
-                    CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'randomize' AND `bot` = '%u'",
-                            randomTime, bot->GetGUIDLow());
-                    CharacterDatabase.PExecute("UPDATE `ai_playerbot_random_bots` SET `validIn` = '%u' WHERE `event` = 'logout' AND `bot` = '%u'",
-                            sPlayerbotAIConfig.maxRandomBotInWorldTime, bot->GetGUIDLow());
+                    sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "randomize", randomTime);
+                    sRandomPlayerbotMgr.SetEventValidIn(bot->GetGUIDLow(), "logout", sPlayerbotAIConfig.maxRandomBotInWorldTime);
                 } while (results->NextRow());
 
                 delete results;
             }
         }
+        sRandomPlayerbotMgr.SaveEventValues();
         return true;
     }
     else
@@ -5,6 +5,8 @@
 #include "PlayerbotAIBase.h"
 #include "PlayerbotMgr.h"
 
+#include <mutex>
+
 class WorldPacket;
 class Player;
 class Unit;
@@ -13,6 +15,25 @@ class Item;
 
 using namespace std;
 
+/**
+ * @brief Cached row of ai_playerbot_random_bots.
+ */
+struct RandomBotEvent
+{
+    uint32 value;
+    uint32 lastChangeTime;
+    uint32 validIn;
+};
+
+/**
+ * @brief Creature spawn position used to pick random bot teleport destinations.
+ */
+struct RandomBotSpawnPoint
+{
+    float x, y, z;
+    uint32 minLevel, maxLevel;
+};
+
 class MANGOS_DLL_SPEC RandomPlayerbotMgr : public PlayerbotHolder
 {
     public:
@@ -42,6 +63,28 @@ class MANGOS_DLL_SPEC RandomPlayerbotMgr : public PlayerbotHolder
         uint32 GetTradeDiscount(Player* bot);
         void Refresh(Player* bot);
         virtual void UpdateAIInternal(uint32 elapsed);
+        /**
+         * @brief Drops all random bot state, both cached and persisted.
+         */
+        void ResetEventValues();
+        /**
+         * @brief Changes the expiry of an existing event without touching its value.
+         */
+        void SetEventValidIn(uint32 bot, string event, uint32 validIn);
+        /**
+         * @brief Writes all modified event values to the character database in one transaction.
+         */
+        void SaveEventValues();
+        /**
+         * @brief Reads the owner 0 rows of ai_playerbot_random_bots into the event cache.
+         *
+         * Called once on the world thread at startup, before map threads look bots up.
+         */
+        void LoadEventValues();
+        /**
+         * @brief Buckets the creature spawns of the random bot maps for teleports, called once at startup.
+         */
+        void LoadTeleportLocations();
 
     protected:
         virtual void OnBotLoginInternal(Player * const bot) {}
@@ -58,10 +101,24 @@ class MANGOS_DLL_SPEC RandomPlayerbotMgr : public PlayerbotHolder
         void RandomTeleportForLevel(Player* bot);
         void RandomTeleport(Player* bot, vector<WorldLocation> &locs);
         uint32 GetZoneLevel(uint32 mapId, float teleX, float teleY, float teleZ);
+        void GetSpawnPointsNear(uint32 mapId, float teleX, float teleY, vector<RandomBotSpawnPoint const*>& points);
 
     private:
+        typedef map<string, RandomBotEvent> BotEventMap;
+        typedef map<uint32, BotEventMap> EventValueCache;
+        typedef set<pair<uint32, string> > DirtyEventSet;
+        typedef map<uint32, vector<RandomBotSpawnPoint> > SpawnCellMap;   // cell key -> spawns
+        typedef map<uint32, SpawnCellMap> SpawnGrid;                        // map id -> cells
+
         vector<Player*> players;
         int processTicks;
+
+        EventValueCache eventValues;            ///< ai_playerbot_random_bots rows for owner 0, by bot
+        DirtyEventSet dirtyEvents;              ///< (bot, event) pairs changed since the last save
+        std::mutex eventLock;                   ///< guards eventValues and dirtyEvents, map threads set loot amounts and teleports
+
+        SpawnGrid spawnGrid;                    ///< creature spawns bucketed in randomBotTeleportDistance cells
+        vector<vector<WorldLocation> > levelLocations;  ///< one spawn per creature template, by suitable bot level
 };
 
 #define sRandomPlayerbotMgr MaNGOS::Singleton<RandomPlayerbotMgr>::Instance()
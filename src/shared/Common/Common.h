@@ -102,6 +102,7 @@
 
 #include "Utilities/Errors.h"
 #include "LockedQueue/LockedQueue.h"
+#include "LockedQueue/MPSCQueue.h"
 #include "Threading/Threading.h"
 
 #include <ace/Basic_Types.h>
@@ -126,7 +126,7 @@ Database::~Database()
     StopServer();
 }
 
-bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
+bool Database::Initialize(const char* infoString, int nConns /*= 1*/, int nHolderConns /*= 0*/)
 {
     // Enable logging of SQL commands (usually only GM commands)
     // (See method: PExecuteLog)
@@ -178,6 +178,19 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
         return false;
     }
 
+    // create connections that execute query holders in parallel
+    for (int i = 0; i < std::min(nHolderConns, int(MAX_CONNECTION_POOL_SIZE)); ++i)
+    {
+        SqlConnection* pConn = CreateConnection();
+        if (!pConn->Initialize(infoString))
+        {
+            delete pConn;
+            return false;
+        }
+
+        m_pHolderConnections.push_back(pConn);
+    }
+
     m_pResultQueue = new SqlResultQueue;
 
     InitDelayThread();
@@ -194,6 +207,13 @@ void Database::StopServer()
     m_pResultQueue = NULL;
     m_pAsyncConn = NULL;
 
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+    {
+        delete m_pHolderConnections[i];
+    }
+
+    m_pHolderConnections.clear();
+
     for (size_t i = 0; i < m_pQueryConnections.size(); ++i)
     {
         delete m_pQueryConnections[i];
@@ -216,6 +236,14 @@ void Database::InitDelayThread()
     m_threadBody = CreateDelayThread();              // will deleted at m_delayThread delete
     m_TransStorage = new ACE_TSS<Database::TransHelper>();
     m_delayThread = new ACE_Based::Thread(m_threadBody);
+
+    // the holder workers are plain delay threads on their own connection
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+    {
+        SqlDelayThread* worker = new SqlDelayThread(this, m_pHolderConnections[i]);
+        m_holderWorkers.push_back(worker);
+        m_holderThreads.push_back(new ACE_Based::Thread(worker));
+    }
 }
 
 void Database::HaltDelayThread()
@@ -232,6 +260,17 @@ void Database::HaltDelayThread()
     m_delayThread = NULL;
     m_threadBody = NULL;
     m_TransStorage=NULL;
+
+    // stopped after the delay thread, which may still hand holders to them while flushing
+    for (size_t i = 0; i < m_holderThreads.size(); ++i)
+    {
+        m_holderWorkers[i]->Stop();
+        m_holderThreads[i]->wait();
+        delete m_holderThreads[i];                          // This also deletes the worker
+    }
+
+    m_holderThreads.clear();
+    m_holderWorkers.clear();
 }
 
 void Database::ThreadStart()
@@ -294,6 +333,12 @@ void Database::Ping()
         SqlConnection::Lock guard(m_pQueryConnections[i]);
         delete guard->Query(sql);
     }
+
+    for (size_t i = 0; i < m_pHolderConnections.size(); ++i)
+    {
+        SqlConnection::Lock guard(m_pHolderConnections[i]);
+        delete guard->Query(sql);
+    }
 }
 
 bool Database::PExecuteLog(const char* format, ...)
@@ -234,9 +234,10 @@ class Database
          *
          * @param infoString
          * @param nConns
+         * @param nHolderConns connections that run the queries of one query holder in parallel, 0 to run holders on the async connection
          * @return bool
          */
-        virtual bool Initialize(const char* infoString, int nConns = 1);
+        virtual bool Initialize(const char* infoString, int nConns = 1, int nHolderConns = 0);
         /**
          * @brief start worker thread for async DB request execution
          *
@@ -635,6 +636,12 @@ class Database
          * @return uint32
          */
         uint32 GetPingIntervall() { return m_pingIntervallms; }
+        /**
+         * @brief number of connections synchronous queries are spread over
+         *
+         * @return int
+         */
+        int GetQueryConnectionCount() const { return m_nQueryConnPoolSize; }
 
         /**
          * @brief function to ping database connections
@@ -792,6 +799,11 @@ class Database
         SqlDelayThread*     m_threadBody;                   /**< Pointer to delay sql executer (owned by m_delayThread) */
         ACE_Based::Thread*  m_delayThread;                  /**< Pointer to executer thread */
 
+        // connections and threads that execute query holders in parallel
+        SqlConnectionContainer m_pHolderConnections;        /**< one connection per holder worker */
+        std::vector<SqlDelayThread*> m_holderWorkers;       /**< Holder query executers (owned by m_holderThreads) */
+        std::vector<ACE_Based::Thread*> m_holderThreads;    /**< Holder worker threads */
+
         bool m_bAllowAsyncTransactions;                     /**< flag which specifies if async transactions are enabled */
 
         // PREPARED STATEMENT REGISTRY
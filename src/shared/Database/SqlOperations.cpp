@@ -117,7 +117,7 @@ void SqlResultQueue::Update()
     }
 }
 
-bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue)
+bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue, std::vector<SqlDelayThread*> const* workers)
 {
     if (!callback || !thread || !queue)
     {
@@ -126,7 +126,7 @@ bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* t
 
     /// delay the execution of the queries, sync them with the delay thread
     /// which will in turn resync on execution (via the queue) and call back
-    SqlQueryHolderEx* holderEx = new SqlQueryHolderEx(this, callback, queue);
+    SqlQueryHolderEx* holderEx = new SqlQueryHolderEx(this, callback, queue, workers);
     thread->Delay(holderEx);
     return true;
 }
@@ -229,21 +229,80 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
         return false;
     }
 
-    LOCK_DB_CONN(conn);
     /// we can do this, we are friends
     std::vector<SqlQueryHolder::SqlResultPair>& queries = m_holder->m_queries;
-    for (size_t i = 0; i < queries.size(); ++i)
+
+    if (m_workers && !m_workers->empty())
     {
-        /// execute all queries in the holder and pass the results
-        char const* sql = queries[i].first;
-        if (sql)
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            if (queries[i].first)
+            {
+                pending.push_back(i);
+            }
+        }
+
+        /// hand the queries out to the workers instead of running them here, everything
+        /// queued on this thread before the holder has already been executed at this point
+        if (pending.size() > 1)
         {
-            m_holder->SetResult(i, conn->Query(sql));
+            SqlQueryHolderTask* task = new SqlQueryHolderTask(m_holder, m_callback, m_queue, long(pending.size()));
+            for (size_t i = 0; i < pending.size(); ++i)
+            {
+                (*m_workers)[i % m_workers->size()]->Delay(new SqlHolderQuery(task, pending[i]));
+            }
+
+            return true;
         }
     }
 
+    {
+        LOCK_DB_CONN(conn);
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            /// execute all queries in the holder and pass the results
+            char const* sql = queries[i].first;
+            if (sql)
+            {
+                m_holder->SetResult(i, conn->Query(sql));
+            }
+        }
+    }
+
+    m_holder->OnResultsReady();
+
+    /// sync with the caller thread
+    m_queue->add(m_callback);
+
+    return true;
+}
+
+void SqlQueryHolderTask::QueryDone()
+{
+    if (--m_pending > 0)
+    {
+        return;
+    }
+
+    m_holder->OnResultsReady();
+
     /// sync with the caller thread
     m_queue->add(m_callback);
 
+    delete this;
+}
+
+bool SqlHolderQuery::Execute(SqlConnection* conn)
+{
+    SqlQueryHolder* holder = m_task->GetHolder();
+
+    {
+        LOCK_DB_CONN(conn);
+        /// every query has its own slot in the holder, no other worker touches it
+        holder->SetResult(m_index, conn->Query(holder->m_queries[m_index].first));
+    }
+
+    m_task->QueryDone();
     return true;
 }
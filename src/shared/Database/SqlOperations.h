@@ -27,8 +27,9 @@
 
 #include "Common/Common.h"
 
+#include <ace/Atomic_Op.h>
 #include <ace/Thread_Mutex.h>
-#include "LockedQueue/LockedQueue.h"
+#include "LockedQueue/MPSCQueue.h"
 #include <queue>
 #include "Utilities/Callback.h"
 
@@ -178,7 +179,7 @@ class SqlQueryHolderEx;                                     /// points to a hold
  * @brief
  *
  */
-class SqlResultQueue : public ACE_Based::LockedQueue<MaNGOS::IQueryCallback* , ACE_Thread_Mutex>
+class SqlResultQueue : public ACE_Based::MPSCQueue<MaNGOS::IQueryCallback*>
 {
     public:
         /**
@@ -234,6 +235,7 @@ class SqlQuery : public SqlOperation
 class SqlQueryHolder
 {
         friend class SqlQueryHolderEx;
+        friend class SqlHolderQuery;
     private:
         /**
          * @brief
@@ -251,7 +253,7 @@ class SqlQueryHolder
          * @brief
          *
          */
-        ~SqlQueryHolder();
+        virtual ~SqlQueryHolder();
         /**
          * @brief
          *
@@ -294,9 +296,16 @@ class SqlQueryHolder
          * @param callback
          * @param thread
          * @param queue
+         * @param workers threads the queries are spread over, NULL or empty to run them all on @p thread
          * @return bool
          */
-        bool Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue);
+        bool Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue, std::vector<SqlDelayThread*> const* workers = NULL);
+        /**
+         * @brief Called on a database thread once all results are set, before the callback is queued.
+         *
+         * Lets a holder prepare its results off the thread that runs the callback.
+         */
+        virtual void OnResultsReady() {}
 };
 
 /**
@@ -309,6 +318,7 @@ class SqlQueryHolderEx : public SqlOperation
         SqlQueryHolder* m_holder; /**< TODO */
         MaNGOS::IQueryCallback* m_callback; /**< TODO */
         SqlResultQueue* m_queue; /**< TODO */
+        std::vector<SqlDelayThread*> const* m_workers; /**< Threads to spread the queries over, may be NULL */
     public:
         /**
          * @brief
@@ -316,9 +326,73 @@ class SqlQueryHolderEx : public SqlOperation
          * @param holder
          * @param callback
          * @param queue
+         * @param workers
+         */
+        SqlQueryHolderEx(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue, std::vector<SqlDelayThread*> const* workers)
+            : m_holder(holder), m_callback(callback), m_queue(queue), m_workers(workers) {}
+        /**
+         * @brief
+         *
+         * @param conn
+         * @return bool
+         */
+        bool Execute(SqlConnection* conn) override;
+};
+
+/**
+ * @brief Completion state of a holder whose queries run in parallel on the holder workers.
+ *
+ * The last finished query calls OnResultsReady(), queues the callback and deletes the task.
+ */
+class SqlQueryHolderTask
+{
+    private:
+        SqlQueryHolder* m_holder; /**< TODO */
+        MaNGOS::IQueryCallback* m_callback; /**< TODO */
+        SqlResultQueue* m_queue; /**< TODO */
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_pending; /**< Queries not finished yet */
+    public:
+        /**
+         * @brief
+         *
+         * @param holder
+         * @param callback
+         * @param queue
+         * @param pending number of queries handed out
+         */
+        SqlQueryHolderTask(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue, long pending)
+            : m_holder(holder), m_callback(callback), m_queue(queue), m_pending(pending) {}
+
+        /**
+         * @brief
+         *
+         * @return SqlQueryHolder
+         */
+        SqlQueryHolder* GetHolder() const { return m_holder; }
+        /**
+         * @brief Marks one query as done, finishes the task after the last one.
+         *
+         */
+        void QueryDone();
+};
+
+/**
+ * @brief One query of a holder, executed by a holder worker.
+ *
+ */
+class SqlHolderQuery : public SqlOperation
+{
+    private:
+        SqlQueryHolderTask* m_task; /**< TODO */
+        size_t m_index; /**< Index of the query in the holder */
+    public:
+        /**
+         * @brief
+         *
+         * @param task
+         * @param index
          */
-        SqlQueryHolderEx(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
-            : m_holder(holder), m_callback(callback), m_queue(queue) {}
+        SqlHolderQuery(SqlQueryHolderTask* task, size_t index) : m_task(task), m_index(index) {}
         /**
          * @brief
          *
@@ -72,6 +72,19 @@ namespace ACE_Based
                 _queue.push_back(item);
             }
 
+            template<class Iterator>
+            /**
+             * @brief Adds a range of items to the queue under a single lock.
+             *
+             * @param first
+             * @param last
+             */
+            void add(Iterator first, Iterator last)
+            {
+                ACE_GUARD (LockType, g, this->_lock);
+                _queue.insert(_queue.end(), first, last);
+            }
+
             /**
              * @brief Gets the next result in the queue, if any.
              *
@@ -0,0 +1,340 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ACE_Based
+{
+    template <class T>
+    /**
+     * @brief Lock-free queue for many producer threads and a single consumer.
+     *
+     * Offers the same add()/next() interface as LockedQueue. A producer links
+     * its node in with a single atomic exchange on the tail, a range add links
+     * the range first so a whole batch costs one exchange. The consumer walks
+     * the list from its own end and never writes shared state, so producers
+     * never wait for the consumer nor for each other.
+     *
+     * An item becomes visible once the producer that exchanged the tail before
+     * it has finished linking, a producer preempted in between briefly hides
+     * what was added after it.
+     *
+     * Only one thread may consume at a time. Consumption may move between
+     * threads as long as the hand-over is synchronized (e.g. the world thread
+     * and the map update threads taking turns on a session).
+     */
+    class MPSCQueue
+    {
+            struct Node
+            {
+                std::atomic<Node*> next;
+                T value;                    // constructed only while the node carries an item
+            };
+
+            /**
+             * @brief Recycles nodes of all queues of this type.
+             *
+             * Producers allocate nodes and the consumer frees them, so every thread
+             * keeps a few in a private cache and only hands them to the shared list,
+             * or takes them back, in chains of NodeBatch under a lock. Nodes are
+             * carved from blocks of NodeBatch and never given back to the system,
+             * like SlabAllocator the cache keeps the peak number of queued items.
+             */
+            class NodeCache
+            {
+                    static const size_t NodeBatch = 64;
+
+                    struct SharedList
+                    {
+                        std::mutex lock;
+                        std::vector<std::pair<Node*, size_t> > chains;  // head and length of each chain
+                    };
+
+                    // never destroyed, nodes may be freed by exiting threads
+                    static SharedList& Shared()
+                    {
+                        static SharedList* list = new SharedList();
+                        return *list;
+                    }
+
+                    static Node* Next(Node* node) { return node->next.load(std::memory_order_relaxed); }
+                    static void SetNext(Node* node, Node* next) { node->next.store(next, std::memory_order_relaxed); }
+
+                    Node* _free;
+                    size_t _count;
+
+                public:
+                    NodeCache() : _free(NULL), _count(0) {}
+
+                    ~NodeCache()
+                    {
+                        if (_free)
+                        {
+                            SharedList& shared = Shared();
+                            std::lock_guard<std::mutex> guard(shared.lock);
+                            shared.chains.push_back(std::make_pair(_free, _count));
+                        }
+                    }
+
+                    static NodeCache& Local()
+                    {
+                        static thread_local NodeCache cache;
+                        return cache;
+                    }
+
+                    Node* Allocate()
+                    {
+                        if (!_free)
+                        {
+                            SharedList& shared = Shared();
+                            std::lock_guard<std::mutex> guard(shared.lock);
+                            if (!shared.chains.empty())
+                            {
+                                _free = shared.chains.back().first;
+                                _count = shared.chains.back().second;
+                                shared.chains.pop_back();
+                            }
+                        }
+
+                        if (!_free)
+                        {
+                            Node* block = static_cast<Node*>(::operator new(sizeof(Node) * NodeBatch));
+                            for (size_t i = NodeBatch; i > 0; --i)
+                            {
+                                new (&block[i - 1].next) std::atomic<Node*>(_free);
+                                _free = &block[i - 1];
+                            }
+                            _count = NodeBatch;
+                        }
+
+                        Node* node = _free;
+                        _free = Next(node);
+                        --_count;
+                        return node;
+                    }
+
+                    void Free(Node* node)
+                    {
+                        SetNext(node, _free);
+                        _free = node;
+                        if (++_count < 2 * NodeBatch)
+                        {
+                            return;
+                        }
+
+                        // give the older half away as one chain
+                        Node* last = _free;
+                        for (size_t i = 1; i < NodeBatch; ++i)
+                        {
+                            last = Next(last);
+                        }
+                        Node* chain = Next(last);
+                        SetNext(last, NULL);
+                        const size_t chainLength = _count - NodeBatch;
+                        _count = NodeBatch;
+
+                        SharedList& shared = Shared();
+                        std::lock_guard<std::mutex> guard(shared.lock);
+                        shared.chains.push_back(std::make_pair(chain, chainLength));
+                    }
+            };
+
+            std::atomic<Node*> _tail; /**< Newest node, producers exchange themselves in here. */
+            Node* _head; /**< Consumer end, the node before the oldest item. Its value is not constructed. */
+
+        public:
+
+            /**
+             * @brief Create an MPSCQueue.
+             *
+             */
+            MPSCQueue() : _tail(NULL), _head(NULL)
+            {
+                _head = NodeCache::Local().Allocate();
+                _head->next.store(NULL, std::memory_order_relaxed);
+                _tail.store(_head, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Destroy an MPSCQueue. Queued items are dropped, not deleted.
+             *
+             */
+            virtual ~MPSCQueue()
+            {
+                T item;
+                while (next(item))
+                {
+                }
+
+                NodeCache::Local().Free(_head);
+            }
+
+            /**
+             * @brief Adds an item to the queue. Safe from any thread.
+             *
+             * @param item
+             */
+            void add(const T& item)
+            {
+                Node* node = NewNode(item);
+                Link(node, node);
+            }
+
+            template<class Iterator>
+            /**
+             * @brief Adds a range of items to the queue with a single atomic exchange.
+             *
+             * @param first
+             * @param last
+             */
+            void add(Iterator first, Iterator last)
+            {
+                if (first == last)
+                {
+                    return;
+                }
+
+                Node* oldest = NewNode(*first);
+                Node* newest = oldest;
+                for (++first; first != last; ++first)
+                {
+                    Node* node = NewNode(*first);
+                    newest->next.store(node, std::memory_order_relaxed);
+                    newest = node;
+                }
+
+                Link(oldest, newest);
+            }
+
+            /**
+             * @brief Gets the next result in the queue, if any. Consumer only.
+             *
+             * @param result
+             * @return bool
+             */
+            bool next(T& result)
+            {
+                Node* node = _head->next.load(std::memory_order_acquire);
+                if (!node)
+                {
+                    return false;
+                }
+
+                result = node->value;
+                Pop(node);
+                return true;
+            }
+
+            template<class Checker>
+            /**
+             * @brief Gets the next result if the checker accepts it, else leaves it queued. Consumer only.
+             *
+             * @param result
+             * @param check
+             * @return bool
+             */
+            bool next(T& result, Checker& check)
+            {
+                Node* node = _head->next.load(std::memory_order_acquire);
+                if (!node)
+                {
+                    return false;
+                }
+
+                result = node->value;
+                if (!check.Process(result))
+                {
+                    return false;
+                }
+
+                Pop(node);
+                return true;
+            }
+
+            template<class Container>
+            /**
+             * @brief Moves everything queued so far to the back of @p out in FIFO order. Consumer only.
+             *
+             * @param out
+             * @return size_t number of items moved
+             */
+            size_t drain(Container& out)
+            {
+                size_t count = 0;
+                while (Node* node = _head->next.load(std::memory_order_acquire))
+                {
+                    out.push_back(node->value);
+                    Pop(node);
+                    ++count;
+                }
+
+                return count;
+            }
+
+            /**
+             * @brief Checks if there is nothing queued. Consumer only.
+             *
+             * @return bool
+             */
+            bool empty() const
+            {
+                return !_head->next.load(std::memory_order_acquire);
+            }
+
+        private:
+            MPSCQueue(MPSCQueue const&) = delete;
+            MPSCQueue& operator=(MPSCQueue const&) = delete;
+
+            static Node* NewNode(const T& value)
+            {
+                Node* node = NodeCache::Local().Allocate();
+                node->next.store(NULL, std::memory_order_relaxed);
+                new (&node->value) T(value);
+                return node;
+            }
+
+            void Link(Node* oldest, Node* newest)
+            {
+                Node* prev = _tail.exchange(newest, std::memory_order_acq_rel);
+                prev->next.store(oldest, std::memory_order_release);
+            }
+
+            // the first item's node becomes the new head, the old head is recycled
+            void Pop(Node* node)
+            {
+                node->value.~T();
+                NodeCache::Local().Free(_head);
+                _head = node;
+            }
+    };
+}
+#endif
@@ -77,7 +77,7 @@ Log::Log() :
     elunaErrLogfile(NULL),
 #endif /* ENABLE_ELUNA */
 
-    eventAiErLogfile(NULL), scriptErrLogFile(NULL), worldLogfile(NULL), wardenLogfile(NULL), m_colored(false),
+    eventAiErLogfile(NULL), scriptErrLogFile(NULL), worldLogfile(NULL), wardenLogfile(NULL), perfLogfile(NULL), m_colored(false),
     m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(NULL)
 {
     Initialize();
@@ -300,6 +300,7 @@ void Log::Initialize()
     raLogfile = openLogFile("RaLogFile", NULL, "a");
     worldLogfile = openLogFile("WorldLogFile", "WorldLogTimestamp", "a");
     wardenLogfile = openLogFile("WardenLogFile", "WardenLogTimestamp", "a");
+    perfLogfile = openLogFile("PerfLogFile", NULL, "a");
 
     // Main log file settings
     m_includeTime  = sConfig.GetBoolDefault("LogTime", false);
@@ -1201,6 +1202,17 @@ void Log::outWorldPacketDump(uint32 socket, uint32 opcode, char const* opcodeNam
     fflush(worldLogfile);
 }
 
+void Log::outPerf(const char* str)
+{
+    if (!perfLogfile)
+    {
+        return;
+    }
+
+    fprintf(perfLogfile, "%s\n", str);
+    fflush(perfLogfile);
+}
+
 void Log::outCharDump(const char* str, uint32 account_id, uint32 guid, const char* name)
 {
     if (charLogfile)
@@ -190,6 +190,12 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Th
                 fclose(wardenLogfile);
             }
             wardenLogfile = NULL;
+
+            if (perfLogfile != NULL)
+            {
+                fclose(perfLogfile);
+            }
+            perfLogfile = NULL;
         }
     public:
         /**
@@ -318,6 +324,12 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Th
          * @param name
          */
         void outCharDump(const char* str, uint32 account_id, uint32 guid, const char* name);
+        /**
+         * @brief any log level, one line per call to PerfLogFile
+         *
+         * @param str
+         */
+        void outPerf(const char* str);
         /**
          * @brief
          *
@@ -462,6 +474,7 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, ACE_Th
         FILE* scriptErrLogFile; /**< TODO */
         FILE* worldLogfile; /**< TODO */
         FILE* wardenLogfile; /**< TODO */
+        FILE* perfLogfile; /**< TODO */
         ACE_Thread_Mutex m_worldLogMtx; /**< TODO */
 
         LogLevel m_logLevel; /**< log/console control */
@@ -27,53 +27,125 @@
 
 #include <random>
 
-#include "ace/Singleton.h"
-#include "ace/Synch_Traits.h"
 #include "Platform/Define.h"
 
+/**
+ * @brief xoshiro256** generator with 32 bytes of state.
+ *
+ * Every thread owns its own instance (see RNG::instance()), so no locking is
+ * involved. An instance must never be shared between threads.
+ */
 class RNGen
 {
 public:
     RNGen()
     {
         std::random_device rd;
-        gen_.seed(rd());
+        seed((uint64(rd()) << 32) | rd());
+    }
+
+    /**
+     * @brief Reseeds the generator, the same seed always gives the same sequence.
+     *
+     * @param value
+     */
+    void seed(uint64 value)
+    {
+        // splitmix64 spreads the seed over the whole state, which must never be all zero
+        for (int i = 0; i < 4; ++i)
+        {
+            value += 0x9E3779B97F4A7C15ULL;
+            uint64 z = value;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            state_[i] = z ^ (z >> 31);
+        }
+    }
+
+    uint64 next()
+    {
+        uint64 const result = rotl(state_[1] * 5, 7) * 9;
+        uint64 const t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+
+        return result;
     }
 
     int32 rand_i(int32 min, int32 max)
     {
-        std::uniform_int_distribution<int32> dist{min, max};
-        return dist(gen_);
+        return int32(uint32(min) + bounded(uint32(max) - uint32(min)));
     }
 
     uint32 rand_u(uint32 min, uint32 max)
     {
-        std::uniform_int_distribution<uint32> dist{min, max};
-        return dist(gen_);
+        return min + bounded(max - min);
     }
 
     uint32 rand()
     {
-        std::uniform_int_distribution<uint32> dist;
-        return dist(gen_);
+        return uint32(next() >> 32);
     }
 
     float rand_f(float min, float max)
     {
-        std::uniform_real_distribution<float> dist{min, max};
-        return dist(gen_);
+        // 24 random bits fill the float mantissa exactly
+        return min + (max - min) * (float(next() >> 40) * (1.0f / 16777216.0f));
     }
 
     double rand_d(double min, double max)
     {
-        std::uniform_real_distribution<double> dist{min, max};
-        return dist(gen_);
+        // 53 random bits fill the double mantissa exactly
+        return min + (max - min) * (double(next() >> 11) * (1.0 / 9007199254740992.0));
     }
 
 private:
-    std::mt19937 gen_;
+    // uniform value in 0..range (inclusive) without modulo bias, Lemire's multiply-shift method
+    uint32 bounded(uint32 range)
+    {
+        if (range == 0xFFFFFFFF)
+        {
+            return rand();
+        }
+
+        uint32 const span = range + 1;
+        uint64 m = uint64(rand()) * span;
+        if (uint32(m) < span)
+        {
+            uint32 const threshold = (0 - span) % span;
+            while (uint32(m) < threshold)
+            {
+                m = uint64(rand()) * span;
+            }
+        }
+
+        return uint32(m >> 32);
+    }
+
+    static uint64 rotl(uint64 x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64 state_[4];
 };
 
-typedef ACE_TSS_Singleton<RNGen, ACE_SYNCH_MUTEX> RNG;
+/**
+ * @brief Access to the generator of the calling thread.
+ */
+class RNG
+{
+public:
+    static RNGen* instance()
+    {
+        static thread_local RNGen gen;
+        return &gen;
+    }
+};
 
-#endif
\ No newline at end of file
+#endif
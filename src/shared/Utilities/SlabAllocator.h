@@ -0,0 +1,143 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_SLABALLOCATOR_H
+#define MANGOS_SLABALLOCATOR_H
+
+#include "Platform/Define.h"
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Fixed size allocator that carves objects of type T out of large slabs.
+ *
+ * Meant to back a class specific operator new/delete of often created and
+ * destroyed world objects. Requests of any other size (derived classes) go to
+ * the global heap, so the class operators can forward blindly. Freed blocks are
+ * kept on a free list for reuse, slabs are never given back to the system.
+ */
+template<class T, uint32 ObjectsPerSlab = 64>
+class SlabAllocator
+{
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned types need an aligned slab");
+
+        union Block
+        {
+            Block* next;
+            alignas(T) char storage[sizeof(T)];
+        };
+
+    public:
+        SlabAllocator() : m_freeList(NULL), m_inUse(0) {}
+
+        /**
+         * @brief Allocator shared by all threads, never destroyed so objects may still be freed at exit.
+         *
+         * @return SlabAllocator
+         */
+        static SlabAllocator& Instance()
+        {
+            static SlabAllocator* instance = new SlabAllocator();
+            return *instance;
+        }
+
+        void* Allocate(size_t size)
+        {
+            if (size != sizeof(T))
+            {
+                return ::operator new(size);
+            }
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (!m_freeList)
+            {
+                Grow();
+            }
+
+            Block* block = m_freeList;
+            m_freeList = block->next;
+            ++m_inUse;
+            return block;
+        }
+
+        void Deallocate(void* ptr, size_t size)
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            if (size != sizeof(T))
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            Block* block = static_cast<Block*>(ptr);
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            block->next = m_freeList;
+            m_freeList = block;
+            --m_inUse;
+        }
+
+        uint32 GetInUseCount() const
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            return m_inUse;
+        }
+
+        uint32 GetCapacity() const
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            return uint32(m_slabs.size()) * ObjectsPerSlab;
+        }
+
+    private:
+        SlabAllocator(SlabAllocator const&) = delete;
+        SlabAllocator& operator=(SlabAllocator const&) = delete;
+
+        // called with m_lock held
+        void Grow()
+        {
+            Block* slab = static_cast<Block*>(::operator new(sizeof(Block) * ObjectsPerSlab));
+            m_slabs.push_back(slab);
+
+            // link back to front so the first allocations come out in address order
+            for (uint32 i = ObjectsPerSlab; i > 0; --i)
+            {
+                slab[i - 1].next = m_freeList;
+                m_freeList = &slab[i - 1];
+            }
+        }
+
+        mutable std::mutex m_lock;
+        Block* m_freeList;
+        uint32 m_inUse;
+        std::vector<Block*> m_slabs;
+};
+
+#endif
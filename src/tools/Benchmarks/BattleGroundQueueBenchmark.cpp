@@ -0,0 +1,329 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * Battleground queue churn simulation: groups of 1-5 players join one
+ * bracket, three of four on the alliance side, waiting groups leave at random
+ * to hold the backlog at a given size, and invited groups leave the queue a
+ * while after their invite. The queue is updated after every join and leave,
+ * like BattleGroundQueue::Update is, and invites 10 against 10 when it can.
+ *
+ * Compares the way BattleGroundQueue used to keep its groups (invited groups
+ * stay in the queue and are skipped by every match, removal looks the group
+ * up, queued players are counted by walking the queue, a fresh std::list per
+ * selection) with the current one (invited groups leave the queue, groups
+ * keep their list position, maintained player counters gate the matching,
+ * the selection vectors are reused). Nothing else of the game is involved.
+ *
+ * Usage: bgqueuebench [steps per run]
+ */
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <list>
+#include <random>
+#include <vector>
+
+typedef std::chrono::steady_clock BenchClock;
+
+static const uint32 TeamCount = 2;
+static const uint32 PlayersPerTeam = 10;
+static const uint32 InviteSteps = 40;               // steps until an invited group leaves the queue
+
+struct BenchGroup
+{
+    uint32 players;
+    uint32 team;
+    bool invited;
+    uint32 invitedAt;
+    size_t waitingIndex;                            // in the waiting groups of the simulation
+    std::list<BenchGroup*>::iterator queuePos;
+};
+
+typedef std::list<BenchGroup*> BenchGroupList;
+typedef std::vector<BenchGroup*> BenchGroupVector;
+
+/// old layout: one list per team, invited groups skipped, lookups and counts by walking
+class ScanQueue
+{
+    public:
+        void AddGroup(BenchGroup* group) { m_groups[group->team].push_back(group); }
+
+        void RemoveGroup(BenchGroup* group)
+        {
+            m_groups[group->team].erase(std::find(m_groups[group->team].begin(), m_groups[group->team].end(), group));
+        }
+
+        uint32 Update(BenchGroupVector& invited)
+        {
+            for (uint32 team = 0; team < TeamCount; ++team)
+            {
+                uint32 queued = 0;
+                for (BenchGroupList::const_iterator itr = m_groups[team].begin(); itr != m_groups[team].end(); ++itr)
+                {
+                    if (!(*itr)->invited)
+                    {
+                        queued += (*itr)->players;
+                    }
+                }
+
+                if (queued < PlayersPerTeam)
+                {
+                    return 0;
+                }
+            }
+
+            BenchGroupList selected[TeamCount];
+            for (uint32 team = 0; team < TeamCount; ++team)
+            {
+                uint32 count = 0;
+                for (BenchGroupList::const_iterator itr = m_groups[team].begin(); itr != m_groups[team].end() && count < PlayersPerTeam; ++itr)
+                {
+                    if (!(*itr)->invited && count + (*itr)->players <= PlayersPerTeam)
+                    {
+                        selected[team].push_back(*itr);
+                        count += (*itr)->players;
+                    }
+                }
+
+                if (count < PlayersPerTeam)
+                {
+                    return 0;
+                }
+            }
+
+            uint32 players = 0;
+            for (uint32 team = 0; team < TeamCount; ++team)
+            {
+                for (BenchGroupList::const_iterator itr = selected[team].begin(); itr != selected[team].end(); ++itr)
+                {
+                    (*itr)->invited = true;
+                    invited.push_back(*itr);
+                    players += (*itr)->players;
+                }
+            }
+
+            return players;
+        }
+
+    private:
+        BenchGroupList m_groups[TeamCount];
+};
+
+/// current layout: waiting and invited lists, stored positions, maintained counters
+class IndexedQueue
+{
+    public:
+        IndexedQueue() { m_queuedPlayers[0] = m_queuedPlayers[1] = 0; }
+
+        void AddGroup(BenchGroup* group)
+        {
+            group->queuePos = m_groups[group->team].insert(m_groups[group->team].end(), group);
+            m_queuedPlayers[group->team] += group->players;
+        }
+
+        void RemoveGroup(BenchGroup* group)
+        {
+            if (group->invited)
+            {
+                m_invited.erase(group->queuePos);
+            }
+            else
+            {
+                m_groups[group->team].erase(group->queuePos);
+                m_queuedPlayers[group->team] -= group->players;
+            }
+        }
+
+        uint32 Update(BenchGroupVector& invited)
+        {
+            if (m_queuedPlayers[0] < PlayersPerTeam || m_queuedPlayers[1] < PlayersPerTeam)
+            {
+                return 0;
+            }
+
+            for (uint32 team = 0; team < TeamCount; ++team)
+            {
+                m_selected[team].clear();
+                uint32 count = 0;
+                for (BenchGroupList::const_iterator itr = m_groups[team].begin(); itr != m_groups[team].end() && count < PlayersPerTeam; ++itr)
+                {
+                    if (count + (*itr)->players <= PlayersPerTeam)
+                    {
+                        m_selected[team].push_back(*itr);
+                        count += (*itr)->players;
+                    }
+                }
+
+                if (count < PlayersPerTeam)
+                {
+                    return 0;
+                }
+            }
+
+            uint32 players = 0;
+            for (uint32 team = 0; team < TeamCount; ++team)
+            {
+                for (BenchGroupVector::const_iterator itr = m_selected[team].begin(); itr != m_selected[team].end(); ++itr)
+                {
+                    BenchGroup* group = *itr;
+                    m_invited.splice(m_invited.end(), m_groups[team], group->queuePos);
+                    m_queuedPlayers[team] -= group->players;
+                    group->invited = true;
+                    invited.push_back(group);
+                    players += group->players;
+                }
+            }
+
+            return players;
+        }
+
+    private:
+        BenchGroupList m_groups[TeamCount];
+        BenchGroupList m_invited;
+        uint32 m_queuedPlayers[TeamCount];
+        BenchGroupVector m_selected[TeamCount];
+};
+
+/// stops waiting, by a leave or an invite
+static void RemoveWaiting(BenchGroupVector& waiting, BenchGroup* group)
+{
+    waiting[group->waitingIndex] = waiting.back();
+    waiting[group->waitingIndex]->waitingIndex = group->waitingIndex;
+    waiting.pop_back();
+}
+
+/// updates the queue, the groups it invites stop waiting
+template<class Queue>
+static uint32 UpdateQueue(Queue& queue, uint32 step, BenchGroupVector& waiting, std::deque<BenchGroup*>& invited, BenchGroupVector& newlyInvited)
+{
+    newlyInvited.clear();
+    uint32 players = queue.Update(newlyInvited);
+    for (BenchGroupVector::const_iterator itr = newlyInvited.begin(); itr != newlyInvited.end(); ++itr)
+    {
+        RemoveWaiting(waiting, *itr);
+        (*itr)->invitedAt = step;
+        invited.push_back(*itr);
+    }
+
+    return players;
+}
+
+/// runs the simulation, returns the invited players
+template<class Queue>
+static uint64 Simulate(uint32 steps, uint32 backlog)
+{
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<uint32> groupSize(1, 5);
+    std::uniform_int_distribution<uint32> side(0, 3);
+
+    Queue queue;
+    BenchGroupVector waiting;
+    std::deque<BenchGroup*> invited;
+    BenchGroupVector newlyInvited;
+    uint64 invitedPlayers = 0;
+
+    for (uint32 step = 0; step < steps; ++step)
+    {
+        BenchGroup* group = new BenchGroup;
+        group->players = groupSize(rng);
+        group->team = side(rng) ? 0 : 1;
+        group->invited = false;
+        group->invitedAt = 0;
+        group->waitingIndex = waiting.size();
+        waiting.push_back(group);
+        queue.AddGroup(group);
+        invitedPlayers += UpdateQueue(queue, step, waiting, invited, newlyInvited);
+
+        if (waiting.size() > backlog)
+        {
+            BenchGroup* leaving = waiting[std::uniform_int_distribution<size_t>(0, waiting.size() - 1)(rng)];
+            RemoveWaiting(waiting, leaving);
+            queue.RemoveGroup(leaving);
+            delete leaving;
+            invitedPlayers += UpdateQueue(queue, step, waiting, invited, newlyInvited);
+        }
+
+        while (!invited.empty() && invited.front()->invitedAt + InviteSteps <= step)
+        {
+            queue.RemoveGroup(invited.front());
+            delete invited.front();
+            invited.pop_front();
+        }
+    }
+
+    for (BenchGroupVector::const_iterator itr = waiting.begin(); itr != waiting.end(); ++itr)
+    {
+        queue.RemoveGroup(*itr);
+        delete *itr;
+    }
+    for (std::deque<BenchGroup*>::const_iterator itr = invited.begin(); itr != invited.end(); ++itr)
+    {
+        queue.RemoveGroup(*itr);
+        delete *itr;
+    }
+
+    return invitedPlayers;
+}
+
+int main(int argc, char** argv)
+{
+    uint32 steps = argc > 1 ? uint32(strtoul(argv[1], NULL, 10)) : 200000;
+    if (!steps)
+    {
+        printf("Usage: %s [steps per run]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%u joins into one bracket, %u against %u, thousand joins per second\n\n", steps, PlayersPerTeam, PlayersPerTeam);
+    printf("%16s %14s %14s %8s\n", "waiting groups", "scan", "indexed", "speedup");
+
+    const uint32 backlogs[] = { 50, 500, 2000, 8000 };
+    for (size_t run = 0; run < sizeof(backlogs) / sizeof(backlogs[0]); ++run)
+    {
+        BenchClock::time_point begin = BenchClock::now();
+        uint64 scanInvited = Simulate<ScanQueue>(steps, backlogs[run]);
+        double scanSeconds = std::chrono::duration<double>(BenchClock::now() - begin).count();
+
+        begin = BenchClock::now();
+        uint64 indexedInvited = Simulate<IndexedQueue>(steps, backlogs[run]);
+        double indexedSeconds = std::chrono::duration<double>(BenchClock::now() - begin).count();
+
+        if (scanInvited != indexedInvited)
+        {
+            printf("invited player mismatch\n");
+            return 1;
+        }
+
+        printf("%16u %14.1f %14.1f %7.2fx\n", backlogs[run],
+               steps / scanSeconds / 1000.0, steps / indexedSeconds / 1000.0, scanSeconds / indexedSeconds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * Contention benchmark for the queues between threads: many producers add
+ * small items while a single consumer takes them out, comparing the mutex
+ * guarded LockedQueue with the lock-free MPSCQueue.
+ *
+ * Usage: queuebench [items per producer] [max producers]
+ */
+
+#include "Platform/Define.h"
+#include "LockedQueue/LockedQueue.h"
+#include "LockedQueue/MPSCQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock BenchClock;
+
+/// consumer that takes items one at a time with next()
+template<class Queue>
+struct NextConsumer
+{
+    static size_t Take(Queue& queue, std::vector<size_t>& /*buffer*/)
+    {
+        size_t count = 0;
+        size_t item;
+        while (queue.next(item))
+        {
+            ++count;
+        }
+        return count;
+    }
+};
+
+/// consumer that empties the queue at once with drain()
+struct DrainConsumer
+{
+    static size_t Take(ACE_Based::MPSCQueue<size_t>& queue, std::vector<size_t>& buffer)
+    {
+        buffer.clear();
+        return queue.drain(buffer);
+    }
+};
+
+template<class Queue, class Consumer>
+static double RunBenchmark(uint32 producers, size_t itemsPerProducer)
+{
+    Queue queue;
+    std::atomic<uint32> ready(0);
+    std::atomic<bool> start(false);
+
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < producers; ++i)
+    {
+        threads.push_back(std::thread([&queue, &ready, &start, itemsPerProducer]()
+        {
+            ++ready;
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+
+            for (size_t n = 0; n < itemsPerProducer; ++n)
+            {
+                queue.add(n);
+            }
+        }));
+    }
+
+    while (ready != producers)
+    {
+        std::this_thread::yield();
+    }
+
+    const size_t total = size_t(producers) * itemsPerProducer;
+    std::vector<size_t> buffer;
+    buffer.reserve(4096);
+
+    BenchClock::time_point begin = BenchClock::now();
+    start = true;
+
+    size_t taken = 0;
+    while (taken < total)
+    {
+        taken += Consumer::Take(queue, buffer);
+    }
+
+    double seconds = std::chrono::duration<double>(BenchClock::now() - begin).count();
+
+    for (std::vector<std::thread>::iterator itr = threads.begin(); itr != threads.end(); ++itr)
+    {
+        itr->join();
+    }
+
+    return double(total) / seconds / 1000000.0;
+}
+
+int main(int argc, char** argv)
+{
+    size_t itemsPerProducer = argc > 1 ? size_t(strtoul(argv[1], NULL, 10)) : 200000;
+    uint32 maxProducers = argc > 2 ? uint32(strtoul(argv[2], NULL, 10)) : 32;
+
+    if (!itemsPerProducer || !maxProducers)
+    {
+        printf("Usage: %s [items per producer] [max producers]\n", argv[0]);
+        return 1;
+    }
+
+    typedef ACE_Based::LockedQueue<size_t, ACE_Thread_Mutex> LockedQueueT;
+    typedef ACE_Based::MPSCQueue<size_t> MPSCQueueT;
+
+    printf("%u items per producer, million items per second through one consumer\n\n", uint32(itemsPerProducer));
+    printf("%10s %14s %14s %14s\n", "producers", "LockedQueue", "MPSC next", "MPSC drain");
+
+    for (uint32 producers = 1; producers <= maxProducers; producers *= 2)
+    {
+        double locked = RunBenchmark<LockedQueueT, NextConsumer<LockedQueueT> >(producers, itemsPerProducer);
+        double mpscNext = RunBenchmark<MPSCQueueT, NextConsumer<MPSCQueueT> >(producers, itemsPerProducer);
+        double mpscDrain = RunBenchmark<MPSCQueueT, DrainConsumer>(producers, itemsPerProducer);
+
+        printf("%10u %14.2f %14.2f %14.2f\n", producers, locked, mpscNext, mpscDrain);
+    }
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * Area target search benchmark: a 40 target AoE in the middle of the cells a
+ * spell search visits, with a varying number of units around it that are in
+ * the visited cells but out of the spell radius.
+ *
+ * Compares the way SpellNotifierCreatureAndPlayer used to collect targets
+ * (faction and targetable checks first, distance last, into a fresh
+ * std::list per search) with the current one (2d radius cull first, into a
+ * pooled std::vector). Units are separate heap objects with a virtual
+ * bounding radius and a faction looked up in a map, like the real ones, but
+ * nothing else of the game is involved.
+ *
+ * Usage: spelltargetbench [casts per run]
+ */
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <random>
+#include <vector>
+
+typedef std::chrono::steady_clock BenchClock;
+
+static const uint32 TargetsInRadius = 40;
+static const float SpellRadius = 10.0f;
+static const float CellSize = 533.3333f / 16.0f;    // SIZE_OF_GRID_CELL
+static const float CenterX = 1.5f * CellSize;      // middle of a 3x3 cell search
+static const float CenterY = 1.5f * CellSize;
+
+struct FactionInfo
+{
+    uint32 ourMask;
+    uint32 friendlyMask;
+};
+
+class BenchUnit
+{
+    public:
+        BenchUnit(float x, float y, uint32 faction) : m_x(x), m_y(y), m_z(0.0f), m_faction(faction), m_targetable(true) {}
+        virtual ~BenchUnit() {}
+
+        virtual float GetObjectBoundingRadius() const { return 0.5f; }
+
+        float m_x;
+        float m_y;
+        float m_z;
+        uint32 m_faction;
+        bool m_targetable;
+        char m_rest[512];                           // the rest of a Unit, keeps units apart in memory
+};
+
+class BenchCaster
+{
+    public:
+        BenchCaster(std::map<uint32, FactionInfo> const& factions, uint32 faction) : m_factions(factions), m_faction(faction) {}
+
+        // stands in for Unit::IsFriendlyTo, a template lookup per call
+        bool IsFriendlyTo(BenchUnit const* unit) const
+        {
+            FactionInfo const& our = m_factions.find(m_faction)->second;
+            FactionInfo const& their = m_factions.find(unit->m_faction)->second;
+            return (our.friendlyMask & their.ourMask) != 0;
+        }
+
+        bool IsWithinDist3d(BenchUnit const* unit, float radius) const
+        {
+            float dx = unit->m_x - CenterX;
+            float dy = unit->m_y - CenterY;
+            float dz = unit->m_z;
+            float maxDist = radius + unit->GetObjectBoundingRadius();
+            return dx * dx + dy * dy + dz * dz < maxDist * maxDist;
+        }
+
+        std::map<uint32, FactionInfo> const& m_factions;
+        uint32 m_faction;
+};
+
+typedef std::vector<BenchUnit*> CellContents;
+
+/// old order: checks, distance last, fresh list per search
+static size_t SearchList(BenchCaster const& caster, std::vector<CellContents> const& cells)
+{
+    std::list<BenchUnit*> targets;
+    for (std::vector<CellContents>::const_iterator cell = cells.begin(); cell != cells.end(); ++cell)
+    {
+        for (CellContents::const_iterator itr = cell->begin(); itr != cell->end(); ++itr)
+        {
+            if (!(*itr)->m_targetable || caster.IsFriendlyTo(*itr))
+            {
+                continue;
+            }
+
+            if (caster.IsWithinDist3d(*itr, SpellRadius))
+            {
+                targets.push_back(*itr);
+            }
+        }
+    }
+
+    return targets.size();
+}
+
+/// new order: 2d cull, then checks, into a reused vector
+static size_t SearchVector(BenchCaster const& caster, std::vector<CellContents> const& cells, std::vector<BenchUnit*>& targets)
+{
+    targets.clear();
+    for (std::vector<CellContents>::const_iterator cell = cells.begin(); cell != cells.end(); ++cell)
+    {
+        for (CellContents::const_iterator itr = cell->begin(); itr != cell->end(); ++itr)
+        {
+            float dx = (*itr)->m_x - CenterX;
+            float dy = (*itr)->m_y - CenterY;
+            float maxDist = SpellRadius + (*itr)->GetObjectBoundingRadius();
+            if (dx * dx + dy * dy > maxDist * maxDist)
+            {
+                continue;
+            }
+
+            if (!(*itr)->m_targetable || caster.IsFriendlyTo(*itr))
+            {
+                continue;
+            }
+
+            if (caster.IsWithinDist3d(*itr, SpellRadius))
+            {
+                targets.push_back(*itr);
+            }
+        }
+    }
+
+    return targets.size();
+}
+
+int main(int argc, char** argv)
+{
+    uint32 casts = argc > 1 ? uint32(strtoul(argv[1], NULL, 10)) : 100000;
+    if (!casts)
+    {
+        printf("Usage: %s [casts per run]\n", argv[0]);
+        return 1;
+    }
+
+    std::map<uint32, FactionInfo> factions;
+    for (uint32 i = 1; i <= 64; ++i)
+    {
+        FactionInfo info;
+        info.ourMask = 1 << (i % 4);
+        info.friendlyMask = 1 << (i % 4);
+        factions[i] = info;
+    }
+
+    BenchCaster caster(factions, 4);                // friendly to factions 4, 8, 12, ...
+
+    printf("%u casts of a %.0f yard AoE with %u targets, thousand casts per second\n\n", casts, SpellRadius, TargetsInRadius);
+    printf("%16s %14s %14s %8s\n", "units outside", "list, checks", "vector, cull", "speedup");
+
+    const uint32 outsideCounts[] = { 0, 100, 400, 1600 };
+    for (size_t run = 0; run < sizeof(outsideCounts) / sizeof(outsideCounts[0]); ++run)
+    {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> inner(0.0f, SpellRadius);
+        std::uniform_real_distribution<float> anywhere(0.0f, 3.0f * CellSize);
+
+        std::vector<BenchUnit*> units;
+        for (uint32 i = 0; i < TargetsInRadius; ++i)
+        {
+            float a = angle(rng);
+            float d = inner(rng);
+            units.push_back(new BenchUnit(CenterX + d * cosf(a), CenterY + d * sinf(a), 1 + 2 * (i % 32)));   // odd factions, hostile
+        }
+        for (uint32 i = 0; i < outsideCounts[run]; ++i)
+        {
+            float x;
+            float y;
+            do
+            {
+                x = anywhere(rng);
+                y = anywhere(rng);
+            }
+            while ((x - CenterX) * (x - CenterX) + (y - CenterY) * (y - CenterY) < (SpellRadius + 1.0f) * (SpellRadius + 1.0f));
+
+            units.push_back(new BenchUnit(x, y, 1 + (i % 64)));
+        }
+        std::shuffle(units.begin(), units.end(), rng);
+
+        std::vector<CellContents> cells(9);
+        for (std::vector<BenchUnit*>::const_iterator itr = units.begin(); itr != units.end(); ++itr)
+        {
+            uint32 cellX = std::min(uint32((*itr)->m_x / CellSize), uint32(2));
+            uint32 cellY = std::min(uint32((*itr)->m_y / CellSize), uint32(2));
+            cells[cellX * 3 + cellY].push_back(*itr);
+        }
+
+        size_t found = 0;
+        BenchClock::time_point begin = BenchClock::now();
+        for (uint32 i = 0; i < casts; ++i)
+        {
+            found += SearchList(caster, cells);
+        }
+        double listSeconds = std::chrono::duration<double>(BenchClock::now() - begin).count();
+
+        std::vector<BenchUnit*> targets;
+        begin = BenchClock::now();
+        for (uint32 i = 0; i < casts; ++i)
+        {
+            found -= SearchVector(caster, cells, targets);
+        }
+        double vectorSeconds = std::chrono::duration<double>(BenchClock::now() - begin).count();
+
+        if (found)
+        {
+            printf("target count mismatch\n");
+            return 1;
+        }
+
+        printf("%16u %14.1f %14.1f %7.2fx\n", outsideCounts[run],
+               casts / listSeconds / 1000.0, casts / vectorSeconds / 1000.0, listSeconds / vectorSeconds);
+
+        for (std::vector<BenchUnit*>::iterator itr = units.begin(); itr != units.end(); ++itr)
+        {
+            delete *itr;
+        }
+    }
+
+    return 0;
+}
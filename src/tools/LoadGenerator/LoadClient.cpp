@@ -0,0 +1,719 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "LoadClient.h"
+#include "Auth/BigNumber.h"
+#include "Auth/Sha1.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Protocol constants, values from game/Server/SharedDefines.h
+#define LG_AUTH_OK                  0x0C
+#define LG_AUTH_WAIT_QUEUE          0x1B
+#define LG_CHAR_CREATE_SUCCESS      0x2E
+#define LG_CHAT_MSG_SAY             0x00
+#define LG_LANG_ORCISH              1
+#define LG_LANG_COMMON              7
+#define LG_MOVEFLAG_FORWARD         0x00000001
+
+#define LG_CLIENT_HEADER_SIZE       6
+#define LG_SERVER_HEADER_SIZE       4
+#define LG_RECV_CHUNK               4096
+#define LG_MAX_CREATE_ATTEMPTS      3
+#define LG_MOVE_RADIUS              10.0f
+
+void LoadClientCrypt::Init(std::vector<uint8> const& key)
+{
+    m_key = key;
+    m_sendI = m_sendJ = m_recvI = m_recvJ = 0;
+    m_initialized = true;
+}
+
+// Inverse of AuthCrypt::DecryptRecv, applied to the 6 byte client header
+void LoadClientCrypt::EncryptSend(uint8* data, size_t len)
+{
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    for (size_t t = 0; t < len; ++t)
+    {
+        m_sendI %= m_key.size();
+        uint8 x = (data[t] ^ m_key[m_sendI]) + m_sendJ;
+        ++m_sendI;
+        data[t] = m_sendJ = x;
+    }
+}
+
+// Inverse of AuthCrypt::EncryptSend, applied to the 4 byte server header
+void LoadClientCrypt::DecryptRecv(uint8* data, size_t len)
+{
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    for (size_t t = 0; t < len; ++t)
+    {
+        m_recvI %= m_key.size();
+        uint8 x = (data[t] - m_recvJ) ^ m_key[m_recvI];
+        ++m_recvI;
+        m_recvJ = data[t];
+        data[t] = x;
+    }
+}
+
+LoadClient::LoadClient(LoadConfig const& config, LoadStats& stats, uint32 index) :
+    m_config(config), m_stats(stats), m_index(index), m_account(LoadAccountName(config, index)),
+    m_socket(-1), m_state(LOAD_STATE_IDLE), m_sendPos(0), m_headerDecrypted(false),
+    m_guid(0), m_race(0), m_mapId(0), m_homeX(0.0f), m_homeY(0.0f), m_homeZ(0.0f), m_angle(0.0f), m_moving(false), m_createAttempts(0),
+    m_loginStart(0), m_pingSent(0), m_worldProbeSent(0), m_mapProbeSent(0), m_pingSeq(0),
+    m_nextMove(0), m_nextChat(0), m_nextSpell(0), m_nextAuction(0), m_nextProbe(0), m_nextTick(0), m_startTime(0)
+{
+}
+
+LoadClient::~LoadClient()
+{
+    Close();
+}
+
+int LoadClient::Connect()
+{
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    char port[8];
+    snprintf(port, sizeof(port), "%u", uint32(m_config.port));
+
+    addrinfo* res = NULL;
+    if (getaddrinfo(m_config.host.c_str(), port, &hints, &res) != 0 || !res)
+    {
+        Fail("cannot resolve host");
+        return -1;
+    }
+
+    m_socket = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (m_socket < 0)
+    {
+        freeaddrinfo(res);
+        Fail("socket() failed");
+        return -1;
+    }
+
+    int one = 1;
+    setsockopt(m_socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    fcntl(m_socket, F_SETFL, fcntl(m_socket, F_GETFL, 0) | O_NONBLOCK);
+
+    int ret = connect(m_socket, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+
+    if (ret < 0 && errno != EINPROGRESS)
+    {
+        Close();
+        Fail("connect() failed");
+        return -1;
+    }
+
+    m_state = LOAD_STATE_CONNECTING;
+    m_startTime = LoadGetMSTime();
+    return m_socket;
+}
+
+void LoadClient::Close()
+{
+    if (m_socket >= 0)
+    {
+        close(m_socket);
+        m_socket = -1;
+    }
+}
+
+void LoadClient::Fail(char const* reason)
+{
+    if (m_state == LOAD_STATE_FAILED)
+    {
+        return;
+    }
+
+    fprintf(stderr, "loadgen: client %u (%s) failed: %s\n", m_index, m_account.c_str(), reason);
+    m_state = LOAD_STATE_FAILED;
+
+    std::lock_guard<std::mutex> guard(m_stats.lock);
+    ++m_stats.failed;
+}
+
+void LoadClient::SendPacket(uint32 opcode, ByteBuffer const& payload)
+{
+    uint16 size = uint16(payload.size() + 4);
+
+    uint8 header[LG_CLIENT_HEADER_SIZE];
+    header[0] = uint8(size >> 8);                           // size is big endian
+    header[1] = uint8(size & 0xFF);
+    header[2] = uint8(opcode & 0xFF);
+    header[3] = uint8((opcode >> 8) & 0xFF);
+    header[4] = uint8((opcode >> 16) & 0xFF);
+    header[5] = uint8((opcode >> 24) & 0xFF);
+    m_crypt.EncryptSend(header, LG_CLIENT_HEADER_SIZE);
+
+    // drop the already written part before growing the buffer
+    if (m_sendPos && m_sendPos == m_sendBuffer.size())
+    {
+        m_sendBuffer.clear();
+        m_sendPos = 0;
+    }
+
+    m_sendBuffer.insert(m_sendBuffer.end(), header, header + LG_CLIENT_HEADER_SIZE);
+    if (payload.size())
+    {
+        m_sendBuffer.insert(m_sendBuffer.end(), payload.contents(), payload.contents() + payload.size());
+    }
+
+    std::lock_guard<std::mutex> guard(m_stats.lock);
+    ++m_stats.packetsSent;
+    m_stats.bytesSent += LG_CLIENT_HEADER_SIZE + payload.size();
+}
+
+bool LoadClient::OnWritable()
+{
+    if (m_state == LOAD_STATE_CONNECTING)
+    {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (getsockopt(m_socket, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err)
+        {
+            Fail("connection refused");
+            return false;
+        }
+
+        m_state = LOAD_STATE_CHALLENGE;
+
+        std::lock_guard<std::mutex> guard(m_stats.lock);
+        ++m_stats.connected;
+    }
+
+    while (m_sendPos < m_sendBuffer.size())
+    {
+        ssize_t n = send(m_socket, &m_sendBuffer[m_sendPos], m_sendBuffer.size() - m_sendPos, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            Fail("send() failed");
+            return false;
+        }
+        m_sendPos += n;
+    }
+
+    if (m_sendPos == m_sendBuffer.size())
+    {
+        m_sendBuffer.clear();
+        m_sendPos = 0;
+    }
+
+    return true;
+}
+
+bool LoadClient::OnReadable()
+{
+    uint8 chunk[LG_RECV_CHUNK];
+    for (;;)
+    {
+        ssize_t n = recv(m_socket, chunk, sizeof(chunk), 0);
+        if (n == 0)
+        {
+            Fail("connection closed by server");
+            return false;
+        }
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            Fail("recv() failed");
+            return false;
+        }
+        m_recvBuffer.insert(m_recvBuffer.end(), chunk, chunk + n);
+    }
+
+    size_t pos = 0;
+    while (m_recvBuffer.size() - pos >= LG_SERVER_HEADER_SIZE)
+    {
+        uint8* header = &m_recvBuffer[pos];
+        if (!m_headerDecrypted)
+        {
+            m_crypt.DecryptRecv(header, LG_SERVER_HEADER_SIZE);
+            m_headerDecrypted = true;
+        }
+
+        uint16 size = (uint16(header[0]) << 8) | header[1];
+        uint16 opcode = uint16(header[2]) | (uint16(header[3]) << 8);
+        if (size < 2)
+        {
+            Fail("malformed packet header");
+            return false;
+        }
+
+        size_t payloadSize = size - 2;
+        if (m_recvBuffer.size() - pos < LG_SERVER_HEADER_SIZE + payloadSize)
+        {
+            break;
+        }
+
+        ByteBuffer data(payloadSize);
+        if (payloadSize)
+        {
+            data.append(header + LG_SERVER_HEADER_SIZE, payloadSize);
+        }
+        pos += LG_SERVER_HEADER_SIZE + payloadSize;
+        m_headerDecrypted = false;
+
+        {
+            std::lock_guard<std::mutex> guard(m_stats.lock);
+            ++m_stats.packetsReceived;
+            m_stats.bytesReceived += LG_SERVER_HEADER_SIZE + payloadSize;
+        }
+
+        try
+        {
+            if (!HandlePacket(opcode, data))
+            {
+                return false;
+            }
+        }
+        catch (ByteBufferException&)
+        {
+            fprintf(stderr, "loadgen: client %u: truncated packet 0x%03X\n", m_index, uint32(opcode));
+        }
+    }
+
+    if (pos)
+    {
+        m_recvBuffer.erase(m_recvBuffer.begin(), m_recvBuffer.begin() + pos);
+    }
+
+    return true;
+}
+
+bool LoadClient::HandlePacket(uint16 opcode, ByteBuffer& data)
+{
+    uint64 now = LoadGetUSTime();
+
+    switch (opcode)
+    {
+        case LG_SMSG_AUTH_CHALLENGE:
+            HandleAuthChallenge(data);
+            break;
+        case LG_SMSG_AUTH_RESPONSE:
+            return HandleAuthResponse(data);
+        case LG_SMSG_CHAR_ENUM:
+            HandleCharEnum(data);
+            break;
+        case LG_SMSG_CHAR_CREATE:
+            return HandleCharCreate(data);
+        case LG_SMSG_LOGIN_VERIFY_WORLD:
+            HandleLoginVerifyWorld(data);
+            break;
+        case LG_SMSG_MESSAGECHAT:
+            HandleMessageChat(data);
+            break;
+        case LG_SMSG_PONG:
+            if (m_pingSent)
+            {
+                m_stats.AddSample(PROBE_PING, uint32(now - m_pingSent));
+                m_pingSent = 0;
+            }
+            break;
+        case LG_SMSG_NAME_QUERY_RESPONSE:
+            if (m_worldProbeSent)
+            {
+                m_stats.AddSample(PROBE_WORLD, uint32(now - m_worldProbeSent));
+                m_worldProbeSent = 0;
+            }
+            break;
+        case LG_SMSG_QUERY_TIME_RESPONSE:
+            if (m_mapProbeSent)
+            {
+                m_stats.AddSample(PROBE_MAP, uint32(now - m_mapProbeSent));
+                m_mapProbeSent = 0;
+            }
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+void LoadClient::HandleAuthChallenge(ByteBuffer& data)
+{
+    if (m_state != LOAD_STATE_CHALLENGE)
+    {
+        return;
+    }
+
+    uint32 serverSeed;
+    data >> serverSeed;
+
+    uint32 clientSeed = m_index * 2654435761u + uint32(LoadGetUSTime());
+
+    BigNumber K;
+    K.SetHexStr(LoadSessionKey(m_config, m_index).c_str());
+
+    // same digest as WorldSocket::HandleAuthSession checks
+    uint8 t[4] = { 0, 0, 0, 0 };
+    Sha1Hash sha;
+    sha.UpdateData(m_account);
+    sha.UpdateData(t, 4);
+    sha.UpdateData((uint8*)&clientSeed, 4);
+    sha.UpdateData((uint8*)&serverSeed, 4);
+    sha.UpdateBigNumbers(&K, nullptr);
+    sha.Finalize();
+
+    ByteBuffer packet(64);
+    packet << uint32(m_config.build);
+    packet << uint32(0);
+    packet << m_account;
+    packet << clientSeed;
+    packet.append(sha.GetDigest(), SHA_DIGEST_LENGTH);
+    // no addon block, AddonHandler::BuildAddonPacket just skips the addon reply
+    SendPacket(LG_CMSG_AUTH_SESSION, packet);
+
+    // the server switches to the encrypted header right after verifying the digest
+    uint8* key = K.AsByteArray(40);
+    m_crypt.Init(std::vector<uint8>(key, key + 40));
+
+    m_state = LOAD_STATE_AUTH;
+}
+
+bool LoadClient::HandleAuthResponse(ByteBuffer& data)
+{
+    uint8 code;
+    data >> code;
+
+    if (code == LG_AUTH_WAIT_QUEUE)
+    {
+        return true;
+    }
+
+    if (code != LG_AUTH_OK)
+    {
+        char reason[48];
+        snprintf(reason, sizeof(reason), "auth response 0x%02X", uint32(code));
+        Fail(reason);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_stats.lock);
+        ++m_stats.authed;
+    }
+
+    m_state = LOAD_STATE_CHAR_ENUM;
+    SendPacket(LG_CMSG_CHAR_ENUM, ByteBuffer(0));
+    return true;
+}
+
+void LoadClient::HandleCharEnum(ByteBuffer& data)
+{
+    if (m_state != LOAD_STATE_CHAR_ENUM)
+    {
+        return;
+    }
+
+    uint8 count;
+    data >> count;
+
+    if (!count)
+    {
+        SendCharCreate();
+        return;
+    }
+
+    uint8 race;
+    data >> m_guid;
+    data.read_skip<char*>();                                // name
+    data >> race;
+    m_race = race;
+
+    m_state = LOAD_STATE_LOGIN;
+    m_loginStart = LoadGetUSTime();
+
+    ByteBuffer packet(8);
+    packet << m_guid;
+    SendPacket(LG_CMSG_PLAYER_LOGIN, packet);
+}
+
+void LoadClient::SendCharCreate()
+{
+    // letters only, one suffix letter per retry in case the name is taken
+    uint32 attempt = m_createAttempts++;
+    if (attempt >= LG_MAX_CREATE_ATTEMPTS)
+    {
+        Fail("character creation failed");
+        return;
+    }
+
+    std::string name = "Lg";
+    uint32 value = m_config.firstAccount + m_index;
+    do
+    {
+        name += char('a' + value % 26);
+        value /= 26;
+    }
+    while (value);
+    name += char('a' + attempt);
+
+    uint8 race = (m_index & 1) ? 2 : 1;                     // orc or human warrior
+    ByteBuffer packet(32);
+    packet << name;
+    packet << race;
+    packet << uint8(1);                                     // class
+    packet << uint8(m_index & 1);                           // gender
+    packet << uint8(0) << uint8(0) << uint8(0) << uint8(0) << uint8(0);
+    packet << uint8(0);                                     // outfit
+    SendPacket(LG_CMSG_CHAR_CREATE, packet);
+
+    m_state = LOAD_STATE_CHAR_CREATE;
+}
+
+bool LoadClient::HandleCharCreate(ByteBuffer& data)
+{
+    uint8 code;
+    data >> code;
+
+    if (code != LG_CHAR_CREATE_SUCCESS)
+    {
+        SendCharCreate();
+        return m_state != LOAD_STATE_FAILED;
+    }
+
+    m_state = LOAD_STATE_CHAR_ENUM;
+    SendPacket(LG_CMSG_CHAR_ENUM, ByteBuffer(0));
+    return true;
+}
+
+void LoadClient::HandleLoginVerifyWorld(ByteBuffer& data)
+{
+    float o;
+    data >> m_mapId >> m_homeX >> m_homeY >> m_homeZ >> o;
+
+    if (m_state != LOAD_STATE_LOGIN)
+    {
+        return;                                             // teleported
+    }
+
+    uint64 now = LoadGetUSTime();
+    m_stats.AddSample(PROBE_LOGIN, uint32(now - m_loginStart));
+
+    {
+        std::lock_guard<std::mutex> guard(m_stats.lock);
+        ++m_stats.inWorld;
+    }
+
+    m_state = LOAD_STATE_IN_WORLD;
+
+    // spread the first actions over one interval so clients do not act in lock step
+    uint64 ms = now / 1000;
+    m_nextMove = ms + (m_config.moveInterval ? m_index % m_config.moveInterval : 0);
+    m_nextChat = ms + (m_config.chatInterval ? m_index * 7919 % m_config.chatInterval : 0);
+    m_nextSpell = ms + (m_config.spellInterval ? m_index * 104729 % m_config.spellInterval : 0);
+    m_nextAuction = ms + (m_config.auctionInterval ? m_index * 1299709 % m_config.auctionInterval : 0);
+    m_nextProbe = ms + (m_config.probeInterval ? m_index % m_config.probeInterval : 0);
+    m_nextTick = ms + m_config.tickInterval;
+}
+
+void LoadClient::HandleMessageChat(ByteBuffer& data)
+{
+    if (m_index != 0)
+    {
+        return;
+    }
+
+    // reply of the .server info sent by the first client, the text is
+    // located by search to stay independent of the chat packet layout
+    static char const pattern[] = "World Delay: ";
+    char const* begin = (char const*)data.contents();
+    char const* end = begin + data.size();
+    char const* found = std::search(begin, end, pattern, pattern + sizeof(pattern) - 1);
+    if (found == end)
+    {
+        return;
+    }
+
+    uint32 delay = 0;
+    for (char const* c = found + sizeof(pattern) - 1; c < end && *c >= '0' && *c <= '9'; ++c)
+    {
+        delay = delay * 10 + (*c - '0');
+    }
+    m_stats.AddSample(PROBE_TICK, delay);
+}
+
+void LoadClient::SendMovement(uint32 opcode, uint32 flags, uint64 now)
+{
+    float x = m_homeX + LG_MOVE_RADIUS * cos(m_angle);
+    float y = m_homeY + LG_MOVE_RADIUS * sin(m_angle);
+
+    ByteBuffer packet(32);
+    packet << flags;
+    packet << uint32(now - m_startTime);                    // client time
+    packet << x << y << m_homeZ << float(m_angle + M_PI / 2);
+    packet << uint32(0);                                    // fall time
+    SendPacket(opcode, packet);
+}
+
+void LoadClient::SendChat(std::string const& text)
+{
+    ByteBuffer packet(text.size() + 9);
+    packet << uint32(LG_CHAT_MSG_SAY);
+    packet << uint32(m_race == 2 ? LG_LANG_ORCISH : LG_LANG_COMMON);
+    packet << text;
+    SendPacket(LG_CMSG_MESSAGECHAT, packet);
+}
+
+void LoadClient::SendProbes()
+{
+    uint64 us = LoadGetUSTime();
+
+    if (!m_worldProbeSent)
+    {
+        ByteBuffer packet(8);
+        packet << m_guid;
+        SendPacket(LG_CMSG_NAME_QUERY, packet);
+        m_worldProbeSent = us;
+    }
+
+    if (!m_mapProbeSent)
+    {
+        SendPacket(LG_CMSG_QUERY_TIME, ByteBuffer(0));
+        m_mapProbeSent = us;
+    }
+}
+
+bool LoadClient::Update(uint64 now)
+{
+    if (m_state == LOAD_STATE_FAILED)
+    {
+        return false;
+    }
+
+    // pings are accepted before login, the world session is created with the auth response
+    if (m_config.pingInterval && m_state >= LOAD_STATE_CHAR_ENUM && !m_pingSent &&
+        (m_pingSeq == 0 || now >= m_startTime + uint64(m_pingSeq) * m_config.pingInterval))
+    {
+        ByteBuffer packet(8);
+        packet << uint32(++m_pingSeq);
+        packet << uint32(0);                                // latency
+        SendPacket(LG_CMSG_PING, packet);
+        m_pingSent = LoadGetUSTime();
+    }
+
+    if (m_state != LOAD_STATE_IN_WORLD)
+    {
+        return true;
+    }
+
+    if (m_config.moveInterval && now >= m_nextMove)
+    {
+        if (!m_moving)
+        {
+            SendMovement(LG_MSG_MOVE_START_FORWARD, LG_MOVEFLAG_FORWARD, now);
+            m_moving = true;
+        }
+        else
+        {
+            // walk a circle around the login position, one step per heartbeat
+            m_angle += 0.1f;
+            if (m_angle > 2 * M_PI)
+            {
+                m_angle -= 2 * M_PI;
+            }
+            SendMovement(LG_MSG_MOVE_HEARTBEAT, LG_MOVEFLAG_FORWARD, now);
+        }
+        m_nextMove = now + m_config.moveInterval;
+    }
+
+    if (m_config.chatInterval && now >= m_nextChat)
+    {
+        char text[64];
+        snprintf(text, sizeof(text), "load test message %u from client %u", uint32(now / 1000), m_index);
+        SendChat(text);
+        m_nextChat = now + m_config.chatInterval;
+    }
+
+    if (m_config.spellInterval && m_config.spellId && now >= m_nextSpell)
+    {
+        ByteBuffer packet(6);
+        packet << uint32(m_config.spellId);
+        packet << uint16(0);                                // TARGET_FLAG_SELF
+        SendPacket(LG_CMSG_CAST_SPELL, packet);
+        m_nextSpell = now + m_config.spellInterval;
+    }
+
+    if (m_config.auctionInterval && m_config.auctioneerGuid && now >= m_nextAuction)
+    {
+        ByteBuffer packet(40);
+        packet << uint64(m_config.auctioneerGuid);
+        packet << uint32(0);                                // list from
+        packet << std::string("");                          // search text
+        packet << uint8(0) << uint8(0);                     // level range
+        packet << uint32(0xFFFFFFFF);                       // inventory slot
+        packet << uint32(0xFFFFFFFF);                       // item class
+        packet << uint32(0xFFFFFFFF);                       // item subclass
+        packet << uint32(0xFFFFFFFF);                       // quality
+        packet << uint8(0);                                 // usable only
+        SendPacket(LG_CMSG_AUCTION_LIST_ITEMS, packet);
+        m_nextAuction = now + m_config.auctionInterval;
+    }
+
+    if (m_config.probeInterval && now >= m_nextProbe)
+    {
+        SendProbes();
+        m_nextProbe = now + m_config.probeInterval;
+    }
+
+    if (m_index == 0 && m_config.tickInterval && now >= m_nextTick)
+    {
+        SendChat(".server info");
+        m_nextTick = now + m_config.tickInterval;
+    }
+
+    return true;
+}
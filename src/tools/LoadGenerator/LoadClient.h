@@ -0,0 +1,143 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#ifndef MANGOS_H_LOADCLIENT
+#define MANGOS_H_LOADCLIENT
+
+#include "LoadGenerator.h"
+#include "Utilities/ByteBuffer.h"
+
+enum LoadClientState
+{
+    LOAD_STATE_IDLE,
+    LOAD_STATE_CONNECTING,
+    LOAD_STATE_CHALLENGE,           ///< waiting for SMSG_AUTH_CHALLENGE
+    LOAD_STATE_AUTH,                ///< waiting for SMSG_AUTH_RESPONSE
+    LOAD_STATE_CHAR_ENUM,
+    LOAD_STATE_CHAR_CREATE,
+    LOAD_STATE_LOGIN,               ///< waiting for SMSG_LOGIN_VERIFY_WORLD
+    LOAD_STATE_IN_WORLD,
+    LOAD_STATE_FAILED
+};
+
+/**
+ * @brief Client side of the 1.12 world header encryption, the mirror of AuthCrypt.
+ */
+class LoadClientCrypt
+{
+    public:
+        LoadClientCrypt() : m_sendI(0), m_sendJ(0), m_recvI(0), m_recvJ(0), m_initialized(false) {}
+
+        void Init(std::vector<uint8> const& key);
+        void EncryptSend(uint8* data, size_t len);
+        void DecryptRecv(uint8* data, size_t len);
+        bool IsInitialized() const { return m_initialized; }
+
+    private:
+        std::vector<uint8> m_key;
+        uint8 m_sendI, m_sendJ, m_recvI, m_recvJ;
+        bool m_initialized;
+};
+
+/**
+ * @brief One simulated player on a non-blocking socket.
+ *
+ * Owned and driven by a single worker thread: OnReadable/OnWritable when epoll
+ * reports the socket, Update once per worker loop for timed actions.
+ */
+class LoadClient
+{
+    public:
+        LoadClient(LoadConfig const& config, LoadStats& stats, uint32 index);
+        ~LoadClient();
+
+        /// Starts a non-blocking connect. Returns the socket or -1.
+        int Connect();
+        void Close();
+
+        /// Returns false when the connection was lost or the session failed.
+        bool OnReadable();
+        bool OnWritable();
+        bool Update(uint64 now);
+
+        int GetSocket() const { return m_socket; }
+        LoadClientState GetState() const { return m_state; }
+        uint32 GetIndex() const { return m_index; }
+        bool HasPendingSend() const { return m_sendPos < m_sendBuffer.size(); }
+
+    private:
+        void SendPacket(uint32 opcode, ByteBuffer const& payload);
+        bool HandlePacket(uint16 opcode, ByteBuffer& data);
+
+        void HandleAuthChallenge(ByteBuffer& data);
+        bool HandleAuthResponse(ByteBuffer& data);
+        void HandleCharEnum(ByteBuffer& data);
+        bool HandleCharCreate(ByteBuffer& data);
+        void HandleLoginVerifyWorld(ByteBuffer& data);
+        void HandleMessageChat(ByteBuffer& data);
+
+        void SendCharCreate();
+        void SendMovement(uint32 opcode, uint32 flags, uint64 now);
+        void SendChat(std::string const& text);
+        void SendProbes();
+        void Fail(char const* reason);
+
+        LoadConfig const& m_config;
+        LoadStats& m_stats;
+        uint32 m_index;
+        std::string m_account;
+
+        int m_socket;
+        LoadClientState m_state;
+        LoadClientCrypt m_crypt;
+
+        std::vector<uint8> m_recvBuffer;
+        std::vector<uint8> m_sendBuffer;
+        size_t m_sendPos;
+        bool m_headerDecrypted;     ///< header at the start of m_recvBuffer was already decrypted
+
+        uint64 m_guid;
+        uint32 m_race;
+        uint32 m_mapId;
+        float m_homeX, m_homeY, m_homeZ;
+        float m_angle;
+        bool m_moving;
+        uint32 m_createAttempts;
+
+        uint64 m_loginStart;
+        uint64 m_pingSent;
+        uint64 m_worldProbeSent;
+        uint64 m_mapProbeSent;
+        uint32 m_pingSeq;
+
+        uint64 m_nextMove;
+        uint64 m_nextChat;
+        uint64 m_nextSpell;
+        uint64 m_nextAuction;
+        uint64 m_nextProbe;
+        uint64 m_nextTick;
+        uint64 m_startTime;
+};
+
+#endif
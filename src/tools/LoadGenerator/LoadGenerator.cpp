@@ -0,0 +1,506 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+#include "LoadGenerator.h"
+#include "LoadClient.h"
+#include "Auth/Sha1.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <csignal>
+#include <thread>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#define LG_EPOLL_EVENTS     256
+#define LG_EPOLL_WAIT_MS    10
+
+static std::atomic<bool> stopEvent(false);
+
+LoadConfig::LoadConfig() :
+    host("127.0.0.1"), port(8085), build(5875),
+    accountPrefix("LOADGEN"), keySeed("loadgen"), firstAccount(0), clients(100), threads(4), connectRate(50), duration(300),
+    moveInterval(500), chatInterval(10000), spellInterval(0), spellId(0), auctionInterval(0), auctioneerGuid(0),
+    probeInterval(1000), pingInterval(30000), tickInterval(5000), reportInterval(5000)
+{
+}
+
+LoadStats::LoadStats() :
+    connected(0), authed(0), inWorld(0), failed(0), packetsSent(0), packetsReceived(0), bytesSent(0), bytesReceived(0)
+{
+}
+
+uint64 LoadGetMSTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64 LoadGetUSTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string LoadAccountName(LoadConfig const& config, uint32 index)
+{
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u", config.firstAccount + index);
+    return config.accountPrefix + buf;
+}
+
+static std::string HexDigest(std::string const& text)
+{
+    Sha1Hash sha;
+    sha.UpdateData(text);
+    sha.Finalize();
+
+    static char const digits[] = "0123456789ABCDEF";
+    std::string hex;
+    for (int i = 0; i < SHA_DIGEST_LENGTH; ++i)
+    {
+        hex += digits[sha.GetDigest()[i] >> 4];
+        hex += digits[sha.GetDigest()[i] & 0x0F];
+    }
+    return hex;
+}
+
+std::string LoadSessionKey(LoadConfig const& config, uint32 index)
+{
+    std::string base = config.keySeed + ":" + LoadAccountName(config, index);
+    std::string key = HexDigest(base + ":0") + HexDigest(base + ":1");
+
+    // WorldSocket keys the header crypt with exactly 40 bytes of K
+    if (key[0] == '0')
+    {
+        key[0] = '1';
+    }
+    return key;
+}
+
+static void PrintUsage(char const* prog)
+{
+    printf("Usage: %s [options]\n"
+           "\n"
+           "Connection:\n"
+           "  --host=ADDR          world server address (127.0.0.1)\n"
+           "  --port=N             world server port (8085)\n"
+           "  --build=N            client build sent in CMSG_AUTH_SESSION (5875)\n"
+           "\n"
+           "Accounts:\n"
+           "  --prefix=NAME        account name prefix, upper case (LOADGEN)\n"
+           "  --seed=TEXT          seed of the generated session keys (loadgen)\n"
+           "  --first=N            index of the first account (0)\n"
+           "  --gen-sql            print the SQL creating the accounts and session keys, then exit\n"
+           "\n"
+           "Load:\n"
+           "  --clients=N          simulated clients (100)\n"
+           "  --threads=N          worker threads (4)\n"
+           "  --connect-rate=N     new connections per second (50)\n"
+           "  --duration=S         test length in seconds, 0 until interrupted (300)\n"
+           "  --move=MS            movement heartbeat interval, 0 disables (500)\n"
+           "  --chat=MS            say interval, 0 disables (10000)\n"
+           "  --spell=MS --spell-id=N      self cast interval and spell (off)\n"
+           "  --auction=MS --auctioneer=GUID  auction browse interval and npc (off)\n"
+           "\n"
+           "Measurement:\n"
+           "  --probe=MS           world and map thread latency probes (1000)\n"
+           "  --ping=MS            CMSG_PING interval (30000)\n"
+           "  --tick=MS            .server info interval of the first client (5000)\n"
+           "  --report=MS          progress line interval (5000)\n"
+           "  --csv=FILE           append one line per report to FILE\n"
+           "\n"
+           "The accounts must exist in the realmd database with the session key from\n"
+           "--gen-sql and Warden must be disabled, realmd itself is not used.\n", prog);
+}
+
+static bool ParseArgs(int argc, char** argv, LoadConfig& config, bool& genSql)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        std::string value;
+
+        size_t eq = arg.find('=');
+        if (eq != std::string::npos)
+        {
+            value = arg.substr(eq + 1);
+            arg = arg.substr(0, eq);
+        }
+
+        uint32 num = uint32(strtoul(value.c_str(), NULL, 10));
+
+        if (arg == "--host")                { config.host = value; }
+        else if (arg == "--port")           { config.port = uint16(num); }
+        else if (arg == "--build")          { config.build = num; }
+        else if (arg == "--prefix")
+        {
+            config.accountPrefix = value;
+            std::transform(config.accountPrefix.begin(), config.accountPrefix.end(), config.accountPrefix.begin(), ::toupper);
+        }
+        else if (arg == "--seed")           { config.keySeed = value; }
+        else if (arg == "--first")          { config.firstAccount = num; }
+        else if (arg == "--gen-sql")        { genSql = true; }
+        else if (arg == "--clients")        { config.clients = num; }
+        else if (arg == "--threads")        { config.threads = std::max(num, 1u); }
+        else if (arg == "--connect-rate")   { config.connectRate = std::max(num, 1u); }
+        else if (arg == "--duration")       { config.duration = num; }
+        else if (arg == "--move")           { config.moveInterval = num; }
+        else if (arg == "--chat")           { config.chatInterval = num; }
+        else if (arg == "--spell")          { config.spellInterval = num; }
+        else if (arg == "--spell-id")       { config.spellId = num; }
+        else if (arg == "--auction")        { config.auctionInterval = num; }
+        else if (arg == "--auctioneer")     { config.auctioneerGuid = strtoull(value.c_str(), NULL, 0); }
+        else if (arg == "--probe")          { config.probeInterval = num; }
+        else if (arg == "--ping")           { config.pingInterval = num; }
+        else if (arg == "--tick")           { config.tickInterval = num; }
+        else if (arg == "--report")         { config.reportInterval = std::max(num, 100u); }
+        else if (arg == "--csv")            { config.csvFile = value; }
+        else
+        {
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void PrintAccountSql(LoadConfig const& config)
+{
+    printf("-- %u load generator accounts for the realmd database\n", config.clients);
+    for (uint32 i = 0; i < config.clients; ++i)
+    {
+        std::string name = LoadAccountName(config, i);
+        printf("INSERT INTO `account` (`username`, `sha_pass_hash`, `sessionkey`, `joindate`) VALUES ('%s', '%s', '%s', NOW()) "
+               "ON DUPLICATE KEY UPDATE `sessionkey` = VALUES(`sessionkey`), `locked` = 0;\n",
+               name.c_str(), HexDigest(name + ":" + name).c_str(), LoadSessionKey(config, i).c_str());
+    }
+}
+
+/**
+ * @brief One epoll loop driving every client whose index maps to it.
+ */
+static void RunWorker(LoadConfig const& config, LoadStats& stats, uint32 workerId)
+{
+    int epollFd = epoll_create1(0);
+    if (epollFd < 0)
+    {
+        fprintf(stderr, "loadgen: epoll_create1 failed\n");
+        return;
+    }
+
+    std::vector<LoadClient*> clients;
+    for (uint32 i = workerId; i < config.clients; i += config.threads)
+    {
+        clients.push_back(new LoadClient(config, stats, i));
+    }
+
+    // the global connect rate is shared evenly by the workers
+    double connectEveryMs = 1000.0 * config.threads / config.connectRate;
+    uint64 begin = LoadGetMSTime();
+    size_t started = 0;
+
+    epoll_event events[LG_EPOLL_EVENTS];
+    while (!stopEvent)
+    {
+        uint64 now = LoadGetMSTime();
+
+        while (started < clients.size() && now >= begin + uint64(started * connectEveryMs))
+        {
+            LoadClient* client = clients[started++];
+            int fd = client->Connect();
+            if (fd < 0)
+            {
+                continue;
+            }
+
+            epoll_event ev;
+            ev.events = EPOLLIN | EPOLLOUT | EPOLLET;
+            ev.data.ptr = client;
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+        }
+
+        int count = epoll_wait(epollFd, events, LG_EPOLL_EVENTS, LG_EPOLL_WAIT_MS);
+        for (int i = 0; i < count; ++i)
+        {
+            LoadClient* client = (LoadClient*)events[i].data.ptr;
+            bool ok = client->GetSocket() >= 0;
+
+            if (ok && (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+            {
+                ok = client->OnWritable();
+            }
+            if (ok && (events[i].events & EPOLLIN))
+            {
+                ok = client->OnReadable();
+            }
+            // answers queued while reading go out right away
+            if (ok && client->HasPendingSend())
+            {
+                ok = client->OnWritable();
+            }
+
+            if (!ok && client->GetSocket() >= 0)
+            {
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, client->GetSocket(), NULL);
+                client->Close();
+            }
+        }
+
+        now = LoadGetMSTime();
+        for (size_t i = 0; i < started; ++i)
+        {
+            LoadClient* client = clients[i];
+            if (client->GetSocket() < 0 || client->GetState() == LOAD_STATE_CONNECTING)
+            {
+                continue;
+            }
+
+            bool ok = client->Update(now);
+            if (ok && client->HasPendingSend())
+            {
+                ok = client->OnWritable();
+            }
+
+            if (!ok)
+            {
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, client->GetSocket(), NULL);
+                client->Close();
+            }
+        }
+    }
+
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        delete clients[i];
+    }
+    close(epollFd);
+}
+
+static uint32 Percentile(std::vector<uint32> const& sorted, uint32 pct)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    return sorted[std::min(sorted.size() - 1, sorted.size() * pct / 100)];
+}
+
+struct LoadTotals
+{
+    uint32 connected, authed, inWorld, failed;
+    uint64 packetsSent, packetsReceived, bytesSent, bytesReceived;
+    std::vector<uint32> samples[MAX_LOAD_PROBES];
+};
+
+/// Sums the worker counters and moves the collected samples out of them.
+static void CollectStats(std::vector<LoadStats*> const& workers, LoadTotals& totals)
+{
+    totals.connected = totals.authed = totals.inWorld = totals.failed = 0;
+    totals.packetsSent = totals.packetsReceived = totals.bytesSent = totals.bytesReceived = 0;
+
+    for (size_t w = 0; w < workers.size(); ++w)
+    {
+        LoadStats& stats = *workers[w];
+        std::lock_guard<std::mutex> guard(stats.lock);
+
+        totals.connected += stats.connected;
+        totals.authed += stats.authed;
+        totals.inWorld += stats.inWorld;
+        totals.failed += stats.failed;
+        totals.packetsSent += stats.packetsSent;
+        totals.packetsReceived += stats.packetsReceived;
+        totals.bytesSent += stats.bytesSent;
+        totals.bytesReceived += stats.bytesReceived;
+
+        for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+        {
+            totals.samples[p].insert(totals.samples[p].end(), stats.samples[p].begin(), stats.samples[p].end());
+            stats.samples[p].clear();
+        }
+    }
+
+    for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+    {
+        std::sort(totals.samples[p].begin(), totals.samples[p].end());
+    }
+}
+
+static char const* probeNames[MAX_LOAD_PROBES] = { "ping", "world", "map", "login", "tick" };
+
+static void PrintProbes(std::vector<uint32> const* samples, FILE* out)
+{
+    for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+    {
+        std::vector<uint32> const& s = samples[p];
+        if (s.empty())
+        {
+            continue;
+        }
+
+        // tick samples are already milliseconds, everything else is microseconds
+        double scale = p == PROBE_TICK ? 1.0 : 0.001;
+        fprintf(out, "  %-6s n=%-7u p50=%.1fms p95=%.1fms p99=%.1fms max=%.1fms\n", probeNames[p], uint32(s.size()),
+                Percentile(s, 50) * scale, Percentile(s, 95) * scale, Percentile(s, 99) * scale, s.back() * scale);
+    }
+}
+
+static void HandleSignal(int)
+{
+    stopEvent = true;
+}
+
+int main(int argc, char** argv)
+{
+    LoadConfig config;
+    bool genSql = false;
+
+    if (!ParseArgs(argc, argv, config, genSql))
+    {
+        return 1;
+    }
+
+    if (genSql)
+    {
+        PrintAccountSql(config);
+        return 0;
+    }
+
+    signal(SIGINT, HandleSignal);
+    signal(SIGTERM, HandleSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    FILE* csv = NULL;
+    if (!config.csvFile.empty())
+    {
+        csv = fopen(config.csvFile.c_str(), "a");
+        if (!csv)
+        {
+            fprintf(stderr, "loadgen: cannot open %s\n", config.csvFile.c_str());
+            return 1;
+        }
+        fprintf(csv, "elapsed_ms,connected,authed,in_world,failed,packets_sent,packets_received");
+        for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+        {
+            fprintf(csv, ",%s_n,%s_p50,%s_p95,%s_p99,%s_max", probeNames[p], probeNames[p], probeNames[p], probeNames[p], probeNames[p]);
+        }
+        fprintf(csv, "\n");
+    }
+
+    printf("loadgen: %u clients as %s%u.. on %s:%u, %u threads, %u connects/s\n", config.clients, config.accountPrefix.c_str(),
+           config.firstAccount, config.host.c_str(), uint32(config.port), config.threads, config.connectRate);
+
+    std::vector<LoadStats*> workerStats;
+    std::vector<std::thread> workers;
+    for (uint32 t = 0; t < config.threads; ++t)
+    {
+        workerStats.push_back(new LoadStats());
+    }
+    for (uint32 t = 0; t < config.threads; ++t)
+    {
+        workers.push_back(std::thread(RunWorker, std::cref(config), std::ref(*workerStats[t]), t));
+    }
+
+    std::vector<uint32> allSamples[MAX_LOAD_PROBES];
+    LoadTotals totals;
+    uint64 start = LoadGetMSTime();
+    uint64 nextReport = start + config.reportInterval;
+    uint64 lastPackets = 0;
+
+    while (!stopEvent)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        uint64 now = LoadGetMSTime();
+        if (config.duration && now >= start + uint64(config.duration) * 1000)
+        {
+            stopEvent = true;
+        }
+        if (now < nextReport && !stopEvent)
+        {
+            continue;
+        }
+        nextReport = now + config.reportInterval;
+
+        CollectStats(workerStats, totals);
+
+        printf("[%6.1fs] connected %u authed %u in world %u failed %u, %.0f packets/s received\n", (now - start) / 1000.0,
+               totals.connected, totals.authed, totals.inWorld, totals.failed,
+               (totals.packetsReceived - lastPackets) * 1000.0 / config.reportInterval);
+        PrintProbes(totals.samples, stdout);
+        fflush(stdout);
+        lastPackets = totals.packetsReceived;
+
+        if (csv)
+        {
+            fprintf(csv, "%u,%u,%u,%u,%u," UI64FMTD "," UI64FMTD, uint32(now - start), totals.connected, totals.authed, totals.inWorld,
+                    totals.failed, totals.packetsSent, totals.packetsReceived);
+            for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+            {
+                std::vector<uint32> const& s = totals.samples[p];
+                fprintf(csv, ",%u,%u,%u,%u,%u", uint32(s.size()), Percentile(s, 50), Percentile(s, 95), Percentile(s, 99), s.empty() ? 0 : s.back());
+            }
+            fprintf(csv, "\n");
+            fflush(csv);
+        }
+
+        for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+        {
+            allSamples[p].insert(allSamples[p].end(), totals.samples[p].begin(), totals.samples[p].end());
+            totals.samples[p].clear();
+        }
+    }
+
+    for (size_t t = 0; t < workers.size(); ++t)
+    {
+        workers[t].join();
+    }
+
+    CollectStats(workerStats, totals);
+    for (int p = 0; p < MAX_LOAD_PROBES; ++p)
+    {
+        allSamples[p].insert(allSamples[p].end(), totals.samples[p].begin(), totals.samples[p].end());
+        std::sort(allSamples[p].begin(), allSamples[p].end());
+    }
+
+    printf("loadgen: finished after %.1fs, %u of %u clients reached the world, %u failed\n", (LoadGetMSTime() - start) / 1000.0,
+           totals.inWorld, config.clients, totals.failed);
+    printf("  sent " UI64FMTD " packets (" UI64FMTD " bytes), received " UI64FMTD " packets (" UI64FMTD " bytes)\n",
+           totals.packetsSent, totals.bytesSent, totals.packetsReceived, totals.bytesReceived);
+    PrintProbes(allSamples, stdout);
+
+    if (csv)
+    {
+        fclose(csv);
+    }
+    for (size_t t = 0; t < workerStats.size(); ++t)
+    {
+        delete workerStats[t];
+    }
+
+    return totals.failed ? 2 : 0;
+}
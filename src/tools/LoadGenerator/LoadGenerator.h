@@ -0,0 +1,152 @@
+/**
+ * MaNGOS is a full featured server for World of Warcraft, supporting
+ * the following clients: 1.12.x, 2.4.3, 3.3.5a, 4.3.4a and 5.4.8
+ *
+ * Copyright (C) 2005-2025 MaNGOS <https://www.getmangos.eu>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * World of Warcraft, and all World of Warcraft or Warcraft art, images,
+ * and lore are copyrighted by Blizzard Entertainment, Inc.
+ */
+
+/**
+ * Headless load generator for mangosd.
+ *
+ * Every simulated client authenticates straight against the world socket with
+ * a session key that was put into the realmd `account` table beforehand
+ * (see --gen-sql), so no realmd has to run. Clients create a character when
+ * their account has none, log in and then replay movement, chat, spell casts
+ * and auction browsing at the configured rates while measuring how long the
+ * server takes to answer.
+ */
+
+#ifndef MANGOS_H_LOADGENERATOR
+#define MANGOS_H_LOADGENERATOR
+
+#include "Common/Common.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Opcodes used by the generator, values from game/Server/Opcodes.h
+enum LoadGenOpcodes
+{
+    LG_CMSG_CHAR_CREATE             = 0x036,
+    LG_CMSG_CHAR_ENUM               = 0x037,
+    LG_SMSG_CHAR_CREATE             = 0x03A,
+    LG_SMSG_CHAR_ENUM               = 0x03B,
+    LG_CMSG_PLAYER_LOGIN            = 0x03D,
+    LG_CMSG_NAME_QUERY              = 0x050,
+    LG_SMSG_NAME_QUERY_RESPONSE     = 0x051,
+    LG_CMSG_MESSAGECHAT             = 0x095,
+    LG_SMSG_MESSAGECHAT             = 0x096,
+    LG_MSG_MOVE_START_FORWARD       = 0x0B5,
+    LG_MSG_MOVE_STOP                = 0x0B7,
+    LG_MSG_MOVE_HEARTBEAT           = 0x0EE,
+    LG_CMSG_CAST_SPELL              = 0x12E,
+    LG_CMSG_QUERY_TIME              = 0x1CE,
+    LG_SMSG_QUERY_TIME_RESPONSE     = 0x1CF,
+    LG_CMSG_PING                    = 0x1DC,
+    LG_SMSG_PONG                    = 0x1DD,
+    LG_SMSG_AUTH_CHALLENGE          = 0x1EC,
+    LG_CMSG_AUTH_SESSION            = 0x1ED,
+    LG_SMSG_AUTH_RESPONSE           = 0x1EE,
+    LG_SMSG_LOGIN_VERIFY_WORLD      = 0x236,
+    LG_CMSG_AUCTION_LIST_ITEMS      = 0x258
+};
+
+/// What a latency sample measured
+enum LoadProbe
+{
+    PROBE_PING,                     ///< CMSG_PING, answered by the network thread
+    PROBE_WORLD,                    ///< CMSG_NAME_QUERY, answered from World::UpdateSessions
+    PROBE_MAP,                      ///< CMSG_QUERY_TIME, answered from Map::Update
+    PROBE_LOGIN,                    ///< CMSG_PLAYER_LOGIN until SMSG_LOGIN_VERIFY_WORLD
+    PROBE_TICK,                     ///< "World Delay" reported by .server info, in ms not us
+    MAX_LOAD_PROBES
+};
+
+struct LoadConfig
+{
+    std::string host;
+    uint16 port;
+    uint32 build;
+
+    std::string accountPrefix;
+    std::string keySeed;
+    uint32 firstAccount;
+    uint32 clients;
+    uint32 threads;
+    uint32 connectRate;             ///< new connections per second
+    uint32 duration;                ///< seconds, 0 runs until interrupted
+
+    uint32 moveInterval;            ///< ms between movement heartbeats, 0 disables
+    uint32 chatInterval;
+    uint32 spellInterval;
+    uint32 spellId;
+    uint32 auctionInterval;
+    uint64 auctioneerGuid;
+    uint32 probeInterval;           ///< ms between world/map latency probes
+    uint32 pingInterval;            ///< ms between CMSG_PING, below 27s counts against MaxOverspeedPings
+    uint32 tickInterval;            ///< ms between .server info requests of the first client
+    uint32 reportInterval;          ///< ms between progress lines
+
+    std::string csvFile;
+
+    LoadConfig();
+};
+
+/**
+ * @brief Counters and latency samples of one worker thread.
+ *
+ * Workers append under the lock, the reporter swaps the sample vectors out.
+ */
+struct LoadStats
+{
+    std::mutex lock;
+
+    uint32 connected;
+    uint32 authed;
+    uint32 inWorld;
+    uint32 failed;
+    uint64 packetsSent;
+    uint64 packetsReceived;
+    uint64 bytesSent;
+    uint64 bytesReceived;
+
+    std::vector<uint32> samples[MAX_LOAD_PROBES];
+
+    LoadStats();
+
+    void AddSample(LoadProbe probe, uint32 value)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        samples[probe].push_back(value);
+    }
+};
+
+/// Milliseconds of a monotonic clock
+uint64 LoadGetMSTime();
+/// Microseconds of a monotonic clock
+uint64 LoadGetUSTime();
+
+/// Account name of client @p index
+std::string LoadAccountName(LoadConfig const& config, uint32 index);
+/// Hex session key (80 digits) stored for and used by client @p index
+std::string LoadSessionKey(LoadConfig const& config, uint32 index);
+
+#endif